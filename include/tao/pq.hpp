@@ -4,20 +4,39 @@
 #ifndef TAO_PQ_HPP
 #define TAO_PQ_HPP
 
+#include <tao/pq/decimal.hpp>
+#include <tao/pq/inet.hpp>
+#include <tao/pq/macaddr.hpp>
 #include <tao/pq/null.hpp>
+#include <tao/pq/uuid.hpp>
 
+#include <tao/pq/async_connection.hpp>
+#include <tao/pq/async_result.hpp>
 #include <tao/pq/connection.hpp>
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/coroutine.hpp>
+#include <tao/pq/cursor.hpp>
+#include <tao/pq/event_loop.hpp>
+#include <tao/pq/notification.hpp>
+#include <tao/pq/pipeline.hpp>
+#include <tao/pq/prepared_statement.hpp>
 #include <tao/pq/transaction.hpp>
 
 #include <tao/pq/field.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/result_cache.hpp>
+#include <tao/pq/result_stream.hpp>
 #include <tao/pq/row.hpp>
 
 #include <tao/pq/parameter_traits.hpp>
 
+#include <tao/pq/result_binary_traits.hpp>
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/result_traits.hpp>
+#include <tao/pq/result_traits_array.hpp>
 #include <tao/pq/result_traits_optional.hpp>
 #include <tao/pq/result_traits_pair.hpp>
+#include <tao/pq/result_traits_struct.hpp>
 #include <tao/pq/result_traits_tuple.hpp>
 
 #endif
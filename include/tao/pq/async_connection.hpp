@@ -0,0 +1,44 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_ASYNC_CONNECTION_HPP
+#define TAO_PQ_ASYNC_CONNECTION_HPP
+
+#include <memory>
+
+#include <tao/pq/poll.hpp>
+
+namespace tao::pq
+{
+   class connection;
+
+   // a connection which is still being established, driven by the connection's socket
+   class async_connection
+   {
+   private:
+      std::shared_ptr< connection > m_connection;
+      poll_status m_status;
+
+   public:
+      // takes a connection from connection::create_async() or one which is already open
+      explicit async_connection( const std::shared_ptr< connection >& connection );
+
+      // the connection's socket, suitable for registration with select(), poll(), epoll(), ...
+      [[nodiscard]] auto socket() const -> int;
+
+      // what the last call to poll() waits for
+      [[nodiscard]] auto status() const noexcept -> poll_status
+      {
+         return m_status;
+      }
+
+      // call when the socket is ready as requested, returns what to wait for before calling it again
+      [[nodiscard]] auto poll() -> poll_status;
+
+      // waits for the connection to be established if necessary, may only be called once
+      [[nodiscard]] auto get() -> std::shared_ptr< connection >;
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,65 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_ASYNC_RESULT_HPP
+#define TAO_PQ_ASYNC_RESULT_HPP
+
+#include <memory>
+#include <optional>
+
+#include <tao/pq/poll.hpp>
+#include <tao/pq/result.hpp>
+
+namespace tao::pq
+{
+   class connection;
+   class transaction;
+
+   class async_result
+   {
+   private:
+      friend class transaction;
+
+      std::shared_ptr< transaction > m_transaction;
+      std::shared_ptr< connection > m_connection;
+      poll_status m_status;
+      bool m_ends_transaction;
+
+      // set when the result was available immediately
+      std::optional< result > m_result;
+
+      explicit async_result( const std::shared_ptr< transaction >& transaction, const bool ends_transaction = false );
+      explicit async_result( result&& r ) noexcept;
+
+      void finish() noexcept;
+
+      // reads all results without blocking in PQgetResult(), waits on the socket instead
+      [[nodiscard]] static auto get_result( connection& c ) -> result;
+
+   public:
+      async_result( const async_result& ) = delete;
+      async_result( async_result&& other ) noexcept;
+      ~async_result();
+
+      void operator=( const async_result& ) = delete;
+      auto operator=( async_result&& other ) noexcept -> async_result&;
+
+      // the connection's socket, suitable for registration with select(), poll(), epoll(), ...
+      [[nodiscard]] auto socket() const -> int;
+
+      // what the last call to poll() waits for
+      [[nodiscard]] auto status() const noexcept -> poll_status
+      {
+         return m_status;
+      }
+
+      // call when the socket is ready as requested, returns what to wait for before calling it again
+      [[nodiscard]] auto poll() -> poll_status;
+
+      // waits for the result if necessary, may only be called once
+      [[nodiscard]] auto get() -> result;
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -4,19 +4,30 @@
 #ifndef TAO_PQ_CONNECTION_HPP
 #define TAO_PQ_CONNECTION_HPP
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <libpq-fe.h>
 
+#include <tao/pq/internal/prepared_cache.hpp>
+#include <tao/pq/notification.hpp>
+#include <tao/pq/poll.hpp>
+#include <tao/pq/prepared_statement.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/transaction.hpp>
 
 namespace tao::pq
 {
+   class async_result;
    class connection_pool;
+   class pipeline;
+   class result_stream;
    class table_writer;
 
    namespace internal
@@ -32,28 +43,49 @@ namespace tao::pq
       : public std::enable_shared_from_this< connection >
    {
    private:
+      friend class async_result;
       friend class connection_pool;
+      friend class pq::pipeline;
+      friend class result_stream;
       friend class pq::transaction;
       friend class table_writer;
 
       const std::unique_ptr< PGconn, internal::deleter > m_pgconn;
       pq::transaction* m_current_transaction;
       std::set< std::string, std::less<> > m_prepared_statements;
+      std::optional< internal::prepared_cache > m_prepared_cache;
+      std::vector< std::string > m_deallocate_pending;  // evicted inside an aborted transaction or in non-blocking mode
 
       [[nodiscard]] auto error_message() const -> std::string;
+      [[nodiscard]] auto escape_identifier( const std::string& identifier ) const -> std::string;
       static void check_prepared_name( const std::string& name );
       [[nodiscard]] auto is_prepared( const char* name ) const noexcept -> bool;
-
-      [[nodiscard]] auto execute_params( const char* statement,
-                                         const int n_params,
-                                         const Oid types[],
-                                         const char* const values[],
-                                         const int lengths[],
-                                         const int formats[] ) -> result;
+      [[nodiscard]] auto auto_prepared( const char* statement, const int n_params, const Oid types[] ) -> const char*;
+      void deallocate_auto_prepared( std::vector< std::string >&& names );
+
+      void send_params( const char* statement,
+                        const int n_params,
+                        const Oid types[],
+                        const char* const values[],
+                        const int lengths[],
+                        const int formats[],
+                        const result_format format );
+
+      void send_prepared( const char* name,
+                          const int n_params,
+                          const char* const values[],
+                          const int lengths[],
+                          const int formats[],
+                          const result_format format );
+
+      [[nodiscard]] auto get_result() -> result;
 
    public:
       [[nodiscard]] static auto create( const std::string& connection_info ) -> std::shared_ptr< connection >;
 
+      // starts establishing the connection without blocking, use connect_poll() to complete it
+      [[nodiscard]] static auto create_async( const std::string& connection_info ) -> std::shared_ptr< connection >;
+
    private:
       // pass-key idiom
       class private_key
@@ -61,10 +93,11 @@ namespace tao::pq
          private_key() = default;
          friend class connection_pool;
          friend auto connection::create( const std::string& connection_info ) -> std::shared_ptr< connection >;
+         friend auto connection::create_async( const std::string& connection_info ) -> std::shared_ptr< connection >;
       };
 
    public:
-      connection( const private_key& /*unused*/, const std::string& connection_info );
+      connection( const private_key& /*unused*/, const std::string& connection_info, const bool async = false );
 
       connection( const connection& ) = delete;
       connection( connection&& ) = delete;
@@ -75,16 +108,56 @@ namespace tao::pq
 
       [[nodiscard]] auto is_open() const noexcept -> bool;
 
-      void prepare( const std::string& name, const std::string& statement );
+      [[nodiscard]] auto socket() const -> int;
+
+      // advances an asynchronously created connection, returns what to wait for on the socket() before calling it again
+      [[nodiscard]] auto connect_poll() -> poll_status;
+
+      // the parameter types are optional, the server infers the types which are omitted or 0
+      auto prepare( const std::string& name, const std::string& statement, const std::vector< Oid >& types = {} ) -> prepared_statement;
       void deallocate( const std::string& name );
+      void deallocate( const prepared_statement& statement );
+
+      // opt-in: statements sent at least threshold times are prepared automatically, the capacity limits
+      // the number of statements remembered, the least recently used ones are deallocated, 0 disables it
+      void set_auto_prepare( const std::size_t capacity, const std::size_t threshold = 5 );
+
+      // LISTEN/NOTIFY, the channel names are used as-is, i.e. they are quoted and case-sensitive
+      void listen( const std::string& channel );
+      void unlisten( const std::string& channel );
+      void notify( const std::string& channel, const std::string& payload = std::string() );
+
+      // a notification received so far, does not block and returns std::nullopt if none is pending,
+      // wait for the socket() to become readable to be informed about new notifications
+      [[nodiscard]] auto get_notification() -> std::optional< notification >;
 
       [[nodiscard]] auto direct() -> std::shared_ptr< pq::transaction >;
       [[nodiscard]] auto transaction( const transaction::isolation_level il = transaction::isolation_level::default_isolation_level ) -> std::shared_ptr< pq::transaction >;
 
-      template< template< typename... > class Traits = parameter_text_traits, typename... Ts >
+      [[nodiscard]] auto pipeline() -> std::shared_ptr< pq::pipeline >;
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... Ts >
       auto execute( Ts&&... ts )
       {
-         return direct()->execute< Traits >( std::forward< Ts >( ts )... );
+         return direct()->execute< Traits, Format >( std::forward< Ts >( ts )... );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... Ts >
+      [[nodiscard]] auto async_execute( Ts&&... ts )
+      {
+         return direct()->async_execute< Traits, Format >( std::forward< Ts >( ts )... );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, typename... Ts >
+      [[nodiscard]] auto cursor( Ts&&... ts )
+      {
+         return direct()->cursor< Traits >( std::forward< Ts >( ts )... );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... Ts >
+      [[nodiscard]] auto stream( Ts&&... ts )
+      {
+         return direct()->stream< Traits, Format >( std::forward< Ts >( ts )... );
       }
 
       [[nodiscard]] auto underlying_raw_ptr() noexcept -> PGconn*
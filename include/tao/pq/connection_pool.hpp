@@ -4,12 +4,15 @@
 #ifndef TAO_PQ_CONNECTION_POOL_HPP
 #define TAO_PQ_CONNECTION_POOL_HPP
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
 
 #include <tao/pq/internal/pool.hpp>
 
+#include <tao/pq/async_connection.hpp>
 #include <tao/pq/connection.hpp>
 #include <tao/pq/result.hpp>
 
@@ -46,10 +49,16 @@ namespace tao::pq
          return this->get();
       }
 
-      template< template< typename... > class Traits = parameter_text_traits, typename... Ts >
+      // like connection(), but a new connection is established without blocking
+      [[nodiscard]] auto async_connection() -> pq::async_connection;
+
+      // opens n connections concurrently and puts them into the pool, throws if they are not established within timeout
+      void warm_up( const std::size_t n, const std::chrono::milliseconds timeout = std::chrono::seconds( 30 ) );
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... Ts >
       auto execute( Ts&&... ts )
       {
-         return this->connection()->direct()->execute< Traits >( std::forward< Ts >( ts )... );
+         return this->connection()->direct()->execute< Traits, Format >( std::forward< Ts >( ts )... );
       }
    };
 
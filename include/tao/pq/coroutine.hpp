@@ -0,0 +1,105 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_COROUTINE_HPP
+#define TAO_PQ_COROUTINE_HPP
+
+#if !defined( TAO_PQ_USE_COROUTINES ) && defined( __cpp_impl_coroutine ) && defined( __has_include )
+// clang-format off
+#if __has_include(<coroutine>)
+// clang-format on
+#define TAO_PQ_USE_COROUTINES
+#endif
+#endif
+
+#if defined( TAO_PQ_USE_COROUTINES )
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+#include <tao/pq/async_connection.hpp>
+#include <tao/pq/async_result.hpp>
+#include <tao/pq/poll.hpp>
+#include <tao/pq/scheduler.hpp>
+
+namespace tao::pq
+{
+   namespace internal
+   {
+      // suspends the awaiting coroutine until T (async_result or async_connection) is ready,
+      // resumption is driven by scheduler::current(), without a scheduler it blocks instead
+      template< typename T >
+      class awaiter
+      {
+      private:
+         T m_operation;
+         scheduler* m_scheduler = nullptr;
+         std::coroutine_handle<> m_handle;
+         std::exception_ptr m_error;
+
+         void wait()
+         {
+            m_scheduler->wait( m_operation.socket(), m_operation.status(), [ this ] {
+               try {
+                  if( m_operation.poll() != poll_status::ready ) {
+                     wait();
+                     return;
+                  }
+               }
+               catch( ... ) {
+                  m_error = std::current_exception();
+               }
+               m_handle.resume();
+            } );
+         }
+
+      public:
+         explicit awaiter( T&& operation ) noexcept
+            : m_operation( std::move( operation ) )
+         {}
+
+         [[nodiscard]] auto await_ready() const noexcept -> bool
+         {
+            return m_operation.status() == poll_status::ready;
+         }
+
+         [[nodiscard]] auto await_suspend( const std::coroutine_handle<> handle ) -> bool
+         {
+            m_scheduler = scheduler::current();
+            if( m_scheduler == nullptr ) {
+               return false;
+            }
+            m_handle = handle;
+            wait();
+            return true;
+         }
+
+         auto await_resume()
+         {
+            if( m_error ) {
+               std::rethrow_exception( m_error );
+            }
+            return m_operation.get();
+         }
+      };
+
+   }  // namespace internal
+
+   // co_await tr->async_execute( ... ), co_await tr->async_commit(), ...
+   [[nodiscard]] inline auto operator co_await( async_result&& r ) noexcept
+   {
+      return internal::awaiter< async_result >( std::move( r ) );
+   }
+
+   // co_await pool->async_connection()
+   [[nodiscard]] inline auto operator co_await( async_connection&& c ) noexcept
+   {
+      return internal::awaiter< async_connection >( std::move( c ) );
+   }
+
+}  // namespace tao::pq
+
+#endif
+
+#endif
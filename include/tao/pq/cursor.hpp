@@ -0,0 +1,145 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_CURSOR_HPP
+#define TAO_PQ_CURSOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <tao/pq/result.hpp>
+#include <tao/pq/row.hpp>
+
+namespace tao::pq
+{
+   class transaction;
+
+   // a server-side cursor, the rows are fetched in batches and the next batch
+   // is requested before the current one is handed out
+   class cursor
+   {
+   private:
+      friend class transaction;
+
+      const std::shared_ptr< transaction > m_transaction;
+      const std::string m_name;
+      const std::string m_fetch;
+      const std::size_t m_fetch_size;
+
+      std::optional< result > m_result;
+      std::size_t m_row;
+      bool m_declared;
+      bool m_pending;
+      bool m_done;
+
+      [[nodiscard]] auto declare( const char* statement, const bool with_hold ) const -> std::string;
+      void start();
+
+      void send_fetch();
+      void receive();
+      void advance();
+
+      [[nodiscard]] auto at_end() const noexcept -> bool
+      {
+         return m_done && ( !m_result || ( m_row >= m_result->m_rows ) );
+      }
+
+   public:
+      // pass-key idiom
+      class private_key
+      {
+         private_key() = default;
+         friend class transaction;
+      };
+
+      cursor( const private_key& /*unused*/, const std::shared_ptr< transaction >& transaction, const std::size_t fetch_size );
+      ~cursor();
+
+      cursor( const cursor& ) = delete;
+      cursor( cursor&& ) = delete;
+      void operator=( const cursor& ) = delete;
+      void operator=( cursor&& ) = delete;
+
+      [[nodiscard]] auto name() const noexcept -> const std::string&
+      {
+         return m_name;
+      }
+
+      [[nodiscard]] auto fetch_size() const noexcept -> std::size_t
+      {
+         return m_fetch_size;
+      }
+
+      // a single pass input iterator, a row is only valid until the next batch was received
+      class const_iterator
+      {
+      private:
+         friend class cursor;
+
+         cursor* m_cursor;
+
+         explicit const_iterator( cursor* c ) noexcept
+            : m_cursor( c )
+         {}
+
+      public:
+         using iterator_category = std::input_iterator_tag;
+         using value_type = row;
+         using difference_type = std::ptrdiff_t;
+         using pointer = void;
+         using reference = row;
+
+         [[nodiscard]] friend auto operator==( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         {
+            return lhs.m_cursor == rhs.m_cursor;
+         }
+
+         [[nodiscard]] friend auto operator!=( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         {
+            return lhs.m_cursor != rhs.m_cursor;
+         }
+
+         auto operator++() -> const_iterator&
+         {
+            m_cursor->advance();
+            if( m_cursor->at_end() ) {
+               m_cursor = nullptr;
+            }
+            return *this;
+         }
+
+         [[nodiscard]] auto operator*() const noexcept -> row
+         {
+            return ( *m_cursor->m_result )[ m_cursor->m_row ];
+         }
+      };
+
+      [[nodiscard]] auto begin() -> const_iterator
+      {
+         return const_iterator( at_end() ? nullptr : this );
+      }
+
+      [[nodiscard]] auto end() noexcept -> const_iterator
+      {
+         return const_iterator( nullptr );
+      }
+
+      // calls f( row ) for each remaining row
+      template< typename F >
+      void for_each( F&& f )
+      {
+         for( const auto& row : *this ) {
+            f( row );
+         }
+      }
+
+      // waits for an outstanding batch and closes the cursor, called by the destructor
+      void close();
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,52 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_DECIMAL_HPP
+#define TAO_PQ_DECIMAL_HPP
+
+#include <string>
+#include <string_view>
+
+namespace tao::pq
+{
+   // a fixed-point decimal number for numeric columns, the value is coefficient * 10^-scale,
+   // the coefficient has 128 bits where the compiler supports them and 64 bits otherwise
+   struct decimal
+   {
+#if defined( __SIZEOF_INT128__ )
+      __extension__ typedef __int128 coefficient_type;
+      __extension__ typedef unsigned __int128 unsigned_coefficient_type;
+#else
+      using coefficient_type = long long;
+      using unsigned_coefficient_type = unsigned long long;
+#endif
+
+      // the largest magnitude of the coefficient, the smallest coefficient_type value is not used
+      static constexpr unsigned_coefficient_type max_magnitude = ~unsigned_coefficient_type( 0 ) >> 1;
+
+      // the largest scale supported by PostgreSQL's numeric
+      static constexpr int max_scale = 16383;
+
+      coefficient_type coefficient = 0;
+      int scale = 0;
+
+      // parses PostgreSQL's text format, e.g. "-12.50", values which do not fit or NaN and infinities throw
+      [[nodiscard]] static auto from_string( const std::string_view value ) -> decimal;
+
+      [[nodiscard]] auto to_string() const -> std::string;
+
+      // equal coefficient and scale, i.e. 1.5 and 1.50 are different
+      [[nodiscard]] friend auto operator==( const decimal& lhs, const decimal& rhs ) noexcept
+      {
+         return ( lhs.coefficient == rhs.coefficient ) && ( lhs.scale == rhs.scale );
+      }
+
+      [[nodiscard]] friend auto operator!=( const decimal& lhs, const decimal& rhs ) noexcept
+      {
+         return !( lhs == rhs );
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,58 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_EVENT_LOOP_HPP
+#define TAO_PQ_EVENT_LOOP_HPP
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/poll.hpp>
+#include <tao/pq/scheduler.hpp>
+
+namespace tao::pq
+{
+   // a minimal poll() based scheduler for applications without an event loop of their own
+   class event_loop final
+      : public scheduler
+   {
+   private:
+      struct waiting
+      {
+         int socket;
+         poll_status status;
+         std::function< void() > callback;
+      };
+
+      std::vector< waiting > m_waiting;
+
+   public:
+      event_loop() = default;
+      ~event_loop() override = default;
+
+      event_loop( const event_loop& ) = delete;
+      event_loop( event_loop&& ) = delete;
+      void operator=( const event_loop& ) = delete;
+      void operator=( event_loop&& ) = delete;
+
+      void wait( const int socket, const poll_status status, std::function< void() > callback ) override;
+
+      // invoke the callback from within run(), e.g. to start coroutines
+      void post( std::function< void() > callback )
+      {
+         wait( -1, poll_status::ready, std::move( callback ) );
+      }
+
+      [[nodiscard]] auto empty() const noexcept -> bool
+      {
+         return m_waiting.empty();
+      }
+
+      // installs itself as the current scheduler and invokes callbacks until nothing is left to wait for
+      void run();
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -8,6 +8,7 @@
 #include <tao/pq/result_traits.hpp>
 
 #include <optional>
+#include <string_view>
 #include <type_traits>
 
 namespace tao::pq
@@ -33,6 +34,12 @@ namespace tao::pq
       [[nodiscard]] auto is_null() const -> bool;
       [[nodiscard]] auto get() const -> const char*;
 
+      [[nodiscard]] auto is_binary() const -> bool;
+      [[nodiscard]] auto length() const -> std::size_t;
+
+      // the value without copying it, valid for the lifetime of (any copy of) the result
+      [[nodiscard]] auto view() const -> std::string_view;
+
       template< typename T >
       [[nodiscard]] auto as() const noexcept
          -> std::enable_if_t< result_traits_size< T > != 1, T >
@@ -0,0 +1,74 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INET_HPP
+#define TAO_PQ_INET_HPP
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace tao::pq
+{
+   // an IPv4 or IPv6 host address with an optional netmask, as stored in an inet column
+   struct inet
+   {
+      enum class family_type : unsigned char
+      {
+         ipv4,
+         ipv6
+      };
+
+      family_type family = family_type::ipv4;
+
+      // the length of the netmask, the full length of the address for a host without a netmask
+      unsigned char bits = 32;
+
+      // in network byte order, an IPv4 address only uses the first four bytes
+      std::array< unsigned char, 16 > address{};
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+      {
+         return ( family == family_type::ipv4 ) ? 4 : 16;
+      }
+
+      [[nodiscard]] auto max_bits() const noexcept -> unsigned
+      {
+         return ( family == family_type::ipv4 ) ? 32 : 128;
+      }
+
+      // accepts e.g. "192.168.0.1", "192.168.0.1/24", "::1", or "::ffff:10.0.0.1/120"
+      [[nodiscard]] static auto from_string( const std::string_view value ) -> inet;
+
+      // the netmask is omitted when it covers the whole address, just like the server does
+      [[nodiscard]] auto to_string() const -> std::string;
+
+      [[nodiscard]] friend auto operator==( const inet& lhs, const inet& rhs ) noexcept
+      {
+         return ( lhs.family == rhs.family ) && ( lhs.bits == rhs.bits ) && ( lhs.address == rhs.address );
+      }
+
+      [[nodiscard]] friend auto operator!=( const inet& lhs, const inet& rhs ) noexcept
+      {
+         return !( lhs == rhs );
+      }
+   };
+
+   // a network address as stored in a cidr column, the bits to the right of the netmask must be zero
+   struct cidr
+      : inet
+   {
+      // accepts the same formats as inet, but throws when bits to the right of the netmask are set
+      [[nodiscard]] static auto from_string( const std::string_view value ) -> cidr;
+
+      // always includes the netmask, just like the server does
+      [[nodiscard]] auto to_string() const -> std::string;
+
+      // throws when bits to the right of the netmask are set
+      void validate() const;
+   };
+
+}  // namespace tao::pq
+
+#endif
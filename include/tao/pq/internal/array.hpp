@@ -0,0 +1,178 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_ARRAY_HPP
+#define TAO_PQ_INTERNAL_ARRAY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/internal/is_bytea_parameter.hpp>
+#include <tao/pq/span.hpp>
+
+namespace tao::pq::internal
+{
+   // containers which are sent as arrays, those of bytes are sent as bytea instead
+   template< typename >
+   inline constexpr bool is_array_parameter = false;
+
+   template< typename T, typename A >
+   inline constexpr bool is_array_parameter< std::vector< T, A > > = !is_bytea_parameter< T >::value;
+
+   template< typename T, std::size_t N >
+   inline constexpr bool is_array_parameter< std::array< T, N > > = !is_bytea_parameter< T >::value;
+
+   template< typename ElementType, std::size_t Extent >
+   inline constexpr bool is_array_parameter< tao::span< ElementType, Extent > > = !is_bytea_parameter< ElementType >::value;
+
+   // the innermost element type and the number of dimensions of nested arrays
+   template< typename T, typename = void >
+   struct array_traits
+   {
+      using element_type = T;
+      static constexpr std::size_t dimensions = 0;
+   };
+
+   template< typename T >
+   struct array_traits< T, std::enable_if_t< is_array_parameter< T > > >
+   {
+      using element_type = typename array_traits< typename T::value_type >::element_type;
+      static constexpr std::size_t dimensions = array_traits< typename T::value_type >::dimensions + 1;
+   };
+
+   // the array type's oid for an element type's oid, or zero if the element type is unknown
+   [[nodiscard]] constexpr auto array_oid( const Oid element ) noexcept -> Oid
+   {
+      switch( element ) {
+         case 16:  // bool
+            return 1000;
+         case 17:  // bytea
+            return 1001;
+         case 18:  // char
+            return 1002;
+         case 20:  // int8
+            return 1016;
+         case 21:  // int2
+            return 1005;
+         case 23:  // int4
+            return 1007;
+         case 25:  // text
+            return 1009;
+         case 650:  // cidr
+            return 651;
+         case 700:  // float4
+            return 1021;
+         case 701:  // float8
+            return 1022;
+         case 829:  // macaddr
+            return 1040;
+         case 869:  // inet
+            return 1041;
+         case 1082:  // date
+            return 1182;
+         case 1114:  // timestamp
+            return 1115;
+         case 1184:  // timestamptz
+            return 1185;
+         case 1186:  // interval
+            return 1187;
+         case 1700:  // numeric
+            return 1231;
+         case 2950:  // uuid
+            return 2951;
+         default:
+            return 0;
+      }
+   }
+
+   // appends an element of an array's text format, quoted and escaped where necessary, or NULL for a null pointer
+   void append_array_element( std::string& buffer, const char* value );
+
+   // the binary array format: the number of dimensions, a flag whether there are NULL elements, the element type's oid,
+   // the size and lower bound of each dimension, and the elements as a 32 bit length, or -1 for NULL, followed by the value,
+   // all 32 bit values are in network byte order
+   void append_array_int32( std::string& buffer, const std::int32_t value );
+
+   // an element of a received array, a null pointer for NULL
+   struct array_element
+   {
+      const char* data;
+      std::size_t size;
+
+      // whether data points to the unescaped, zero-terminated copy in the scratch buffer instead of into the received value
+      bool copied;
+   };
+
+   // reads the text format of an array, e.g. {1,NULL,"a \"b\""}, an optional dimension decoration like [0:1]= is skipped
+   class array_text_parser
+   {
+   private:
+      const char* m_p;
+      const char* const m_end;
+
+      void skip_whitespace() noexcept;
+      [[noreturn]] void invalid() const;
+
+   public:
+      array_text_parser( const char* value, const std::size_t size );
+
+      // the number of elements of the (sub-)array which starts at the current position, for reserving space
+      [[nodiscard]] auto count() const noexcept -> std::size_t;
+
+      // consumes the opening brace, returns false for an empty array, whose closing brace is consumed as well
+      [[nodiscard]] auto open() -> bool;
+
+      // consumes a separator and returns true, or the closing brace and returns false
+      [[nodiscard]] auto next() -> bool;
+
+      [[nodiscard]] auto element( std::string& scratch ) -> array_element;
+
+      // ensures there is nothing left but whitespace
+      void finish();
+   };
+
+   // reads the binary format of an array, see append_array_int32() for the format
+   class array_binary_reader
+   {
+   private:
+      const char* m_p;
+      const char* const m_end;
+      std::size_t m_dimensions;
+      Oid m_element_type;
+      std::size_t m_sizes[ 6 ];
+
+   public:
+      array_binary_reader( const char* value, const std::size_t size );
+
+      // zero for an empty array
+      [[nodiscard]] auto dimensions() const noexcept -> std::size_t
+      {
+         return m_dimensions;
+      }
+
+      // the oid of the elements' type, which is passed to their decoder
+      [[nodiscard]] auto element_type() const noexcept -> Oid
+      {
+         return m_element_type;
+      }
+
+      [[nodiscard]] auto size( const std::size_t dimension ) const noexcept -> std::size_t
+      {
+         return m_sizes[ dimension ];
+      }
+
+      [[nodiscard]] auto element() -> array_element;
+
+      // ensures all elements were read
+      void finish() const;
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
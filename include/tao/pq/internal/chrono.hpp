@@ -0,0 +1,119 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_CHRONO_HPP
+#define TAO_PQ_INTERNAL_CHRONO_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+
+#include <libpq-fe.h>
+
+// libstdc++ provides the C++20 calendar types before announcing the complete C++20 chrono support
+#if !defined( TAO_PQ_USE_CALENDAR ) && ( __cplusplus > 201703L )
+#if( defined( __cpp_lib_chrono ) && ( __cpp_lib_chrono >= 201907L ) ) || ( defined( _GLIBCXX_RELEASE ) && ( _GLIBCXX_RELEASE >= 11 ) )
+#define TAO_PQ_USE_CALENDAR
+#endif
+#endif
+
+namespace tao::pq::internal
+{
+   // PostgreSQL counts dates in days and timestamps in microseconds since 2000-01-01, i.e. 10957 days after the Unix epoch,
+   // timestamptz values are UTC, intervals also store days and months separately
+
+   inline constexpr std::int64_t postgres_epoch_days = 10957;
+   inline constexpr std::int64_t postgres_epoch_microseconds = postgres_epoch_days * 86400 * 1000000;
+
+   // time points with a precision of days are dates, all others are timestamps
+   template< typename Duration >
+   inline constexpr bool is_date = std::is_same_v< typename Duration::period, std::ratio< 86400 > >;
+
+   // large enough for the longest timestamp and interval, including the terminating zero
+   inline constexpr std::size_t chrono_buffer_size = 48;
+
+   // the text formats are those of DateStyle ISO and IntervalStyle postgres, which are the defaults,
+   // the functions return the length of the text written to buffer
+   [[nodiscard]] auto format_date( char* buffer, const std::int64_t days ) noexcept -> std::size_t;
+   [[nodiscard]] auto format_timestamp( char* buffer, const std::int64_t microseconds ) noexcept -> std::size_t;
+   [[nodiscard]] auto format_interval( char* buffer, const std::int64_t microseconds ) noexcept -> std::size_t;
+
+   // parses a date, or a timestamp with an optional UTC offset, into microseconds since 2000-01-01 UTC,
+   // values without an offset are considered UTC
+   [[nodiscard]] auto parse_timestamp( const char* value ) -> std::int64_t;
+
+   // parses an interval without years or months, or a time of day, into microseconds
+   [[nodiscard]] auto parse_interval( const char* value ) -> std::int64_t;
+
+   // decodes binary date, timestamp and timestamptz values into microseconds since 2000-01-01 UTC
+   [[nodiscard]] auto decode_timestamp( const char* value, const std::size_t size, const Oid type ) -> std::int64_t;
+
+   // decodes binary interval and time values into microseconds
+   [[nodiscard]] auto decode_interval( const char* value, const std::size_t size, const Oid type ) -> std::int64_t;
+
+   [[nodiscard]] auto chrono_overflow( const char* type ) -> std::overflow_error;
+
+   template< typename Rep, typename Period >
+   [[nodiscard]] auto to_microseconds( const std::chrono::duration< Rep, Period > v ) -> std::int64_t
+   {
+      using microseconds = std::chrono::duration< long double, std::micro >;
+      if constexpr( std::ratio_greater_v< Period, std::micro > || std::is_floating_point_v< Rep > ) {
+         const auto m = std::chrono::duration_cast< microseconds >( v ).count();
+         if( ( m >= 9223372036854775807.0L ) || ( m < -9223372036854775808.0L ) ) {
+            throw chrono_overflow( "std::chrono::duration" );
+         }
+      }
+      return std::chrono::floor< std::chrono::microseconds >( v ).count();
+   }
+
+   template< typename Duration >
+   [[nodiscard]] auto from_microseconds( const std::int64_t v ) -> Duration
+   {
+      using microseconds = std::chrono::microseconds;
+      if constexpr( !std::is_floating_point_v< typename Duration::rep > ) {
+         // the value in units of Duration, which must fit into its rep after rounding down, also for rep narrower than 64 bits
+         using ratio = std::ratio_divide< std::micro, typename Duration::period >;
+         const long double d = static_cast< long double >( v ) * ratio::num / ratio::den;
+         if( ( d >= static_cast< long double >( Duration::max().count() ) + 1 ) || ( d < static_cast< long double >( Duration::min().count() ) ) ) {
+            throw chrono_overflow( "std::chrono::duration" );
+         }
+      }
+      return std::chrono::floor< Duration >( microseconds( v ) );
+   }
+
+   template< typename Duration >
+   [[nodiscard]] auto to_postgres_microseconds( const std::chrono::time_point< std::chrono::system_clock, Duration > v ) -> std::int64_t
+   {
+      const std::int64_t m = to_microseconds( v.time_since_epoch() );
+      if( m < -9223372036854775807LL + postgres_epoch_microseconds ) {
+         throw chrono_overflow( "std::chrono::time_point" );
+      }
+      return m - postgres_epoch_microseconds;
+   }
+
+   template< typename Duration >
+   [[nodiscard]] auto from_postgres_microseconds( const std::int64_t v ) -> std::chrono::time_point< std::chrono::system_clock, Duration >
+   {
+      if( v > 9223372036854775807LL - postgres_epoch_microseconds ) {
+         throw chrono_overflow( "std::chrono::time_point" );
+      }
+      return std::chrono::time_point< std::chrono::system_clock, Duration >( from_microseconds< Duration >( v + postgres_epoch_microseconds ) );
+   }
+
+#if defined( TAO_PQ_USE_CALENDAR )
+   // unlike sys_days' conversion, which is unspecified for invalid dates, throws for e.g. February 30th
+   [[nodiscard]] inline auto to_sys_days( const std::chrono::year_month_day v ) -> std::chrono::sys_days
+   {
+      if( !v.ok() ) {
+         throw std::invalid_argument( "invalid date in tao::pq for std::chrono::year_month_day" );
+      }
+      return std::chrono::sys_days( v );
+   }
+#endif
+
+}  // namespace tao::pq::internal
+
+#endif
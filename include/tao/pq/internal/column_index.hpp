@@ -0,0 +1,71 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_COLUMN_INDEX_HPP
+#define TAO_PQ_INTERNAL_COLUMN_INDEX_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/internal/snapshot.hpp>
+
+namespace tao::pq::internal
+{
+   // owns a PGresult or a snapshot and maps its column names to column indices like PQfnumber(),
+   // but with a hash table which is built on first use
+   class column_index
+   {
+   private:
+      const std::unique_ptr< PGresult, decltype( &PQclear ) > m_pgresult;
+      const std::unique_ptr< const internal::snapshot > m_snapshot;
+
+      std::once_flag m_once;
+      std::unordered_map< std::string_view, std::size_t > m_first;  // views into m_pgresult or m_snapshot
+      std::vector< std::size_t > m_next;                            // the next column with the same name
+
+      void build();
+
+   public:
+      static constexpr std::size_t npos = static_cast< std::size_t >( -1 );
+
+      explicit column_index( PGresult* pgresult ) noexcept
+         : m_pgresult( pgresult, &PQclear )
+      {}
+
+      explicit column_index( std::unique_ptr< const internal::snapshot >&& in_snapshot ) noexcept
+         : m_pgresult( nullptr, &PQclear ),
+           m_snapshot( std::move( in_snapshot ) )
+      {}
+
+      column_index( const column_index& ) = delete;
+      column_index( column_index&& ) = delete;
+      ~column_index() = default;
+
+      void operator=( const column_index& ) = delete;
+      void operator=( column_index&& ) = delete;
+
+      [[nodiscard]] auto pgresult() const noexcept -> PGresult*
+      {
+         return m_pgresult.get();
+      }
+
+      [[nodiscard]] auto snapshot() const noexcept -> const internal::snapshot*
+      {
+         return m_snapshot.get();
+      }
+
+      // the first column at or after offset which matches name, or npos,
+      // unquoted parts of name are folded to lower case, quoted parts are used as-is
+      [[nodiscard]] auto find( const char* name, const std::size_t offset = 0 ) -> std::size_t;
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,47 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_FROM_CHARS_HPP
+#define TAO_PQ_INTERNAL_FROM_CHARS_HPP
+
+#include <cassert>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <system_error>
+#include <type_traits>
+
+#if !defined( TAO_PQ_USE_FLOATING_POINT_FROM_CHARS ) && defined( __cpp_lib_to_chars )
+#define TAO_PQ_USE_FLOATING_POINT_FROM_CHARS
+#endif
+
+namespace tao::pq::internal
+{
+   // locale-independent fast path for parsing a value as sent by the server,
+   // yields no value if the input is not accepted as a whole or is out of range,
+   // the caller then falls back to the strtox functions which report the error
+   template< typename T >
+   [[nodiscard]] auto from_chars( const char* input ) noexcept -> std::optional< T >
+   {
+      static_assert( std::is_arithmetic_v< T > );
+      assert( input );
+#if !defined( TAO_PQ_USE_FLOATING_POINT_FROM_CHARS )
+      if constexpr( std::is_floating_point_v< T > ) {
+         return std::nullopt;
+      }
+      else
+#endif
+      {
+         const char* end = input + std::strlen( input );
+         T nrv;
+         const auto [ ptr, ec ] = std::from_chars( input, end, nrv );
+         if( ( ec == std::errc() ) && ( ptr == end ) ) {
+            return nrv;
+         }
+         return std::nullopt;
+      }
+   }
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,28 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_HEX_HPP
+#define TAO_PQ_INTERNAL_HEX_HPP
+
+namespace tao::pq::internal
+{
+   inline constexpr char hex_digits[] = "0123456789abcdef";
+
+   // returns -1 for characters which are not hexadecimal digits, accepts upper and lower case
+   [[nodiscard]] constexpr auto hex_value( const char c ) noexcept -> int
+   {
+      if( ( c >= '0' ) && ( c <= '9' ) ) {
+         return c - '0';
+      }
+      if( ( c >= 'a' ) && ( c <= 'f' ) ) {
+         return c - 'a' + 10;
+      }
+      if( ( c >= 'A' ) && ( c <= 'F' ) ) {
+         return c - 'A' + 10;
+      }
+      return -1;
+   }
+
+}  // namespace tao::pq::internal
+
+#endif
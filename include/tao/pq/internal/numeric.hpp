@@ -0,0 +1,34 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_NUMERIC_HPP
+#define TAO_PQ_INTERNAL_NUMERIC_HPP
+
+#include <cstddef>
+#include <string_view>
+
+#include <tao/pq/decimal.hpp>
+
+namespace tao::pq::internal
+{
+   // PostgreSQL's binary numeric format: ndigits, weight, sign and dscale as 16 bit values in network byte order,
+   // followed by ndigits base 10000 digits, the first of which is multiplied by 10000^weight
+
+   // the decimal digits of any coefficient's magnitude
+   inline constexpr std::size_t magnitude_buffer_size = 40;
+
+   // 39 significant decimal digits span at most 11 base 10000 digits
+   inline constexpr std::size_t numeric_buffer_size = 8 + 2 * 11;
+
+   // writes the decimal digits of the magnitude without leading zeros, zero yields no digits
+   [[nodiscard]] auto magnitude_digits( char* buffer, decimal::unsigned_coefficient_type magnitude ) noexcept -> std::string_view;
+
+   // encodes the decimal digits, of which the last 'scale' are fractional, the digits must have at most 39 significant digits
+   [[nodiscard]] auto encode_numeric( char* buffer, std::string_view digits, const std::size_t scale, const bool negative ) noexcept -> std::size_t;
+
+   // NaN and infinities throw, just like values whose coefficient does not fit
+   [[nodiscard]] auto decode_numeric( const char* value, const std::size_t size ) -> decimal;
+
+}  // namespace tao::pq::internal
+
+#endif
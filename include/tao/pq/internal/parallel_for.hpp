@@ -0,0 +1,56 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_PARALLEL_FOR_HPP
+#define TAO_PQ_INTERNAL_PARALLEL_FOR_HPP
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace tao::pq::internal
+{
+   // calls f( first, last ) for 'threads' consecutive partitions of [ 0, n ), the first partition on the calling thread,
+   // rethrows the exception of the lowest partition that failed after all threads have finished
+   template< typename F >
+   void parallel_for( const std::size_t n, const std::size_t threads, const F& f )
+   {
+      std::vector< std::exception_ptr > errors( threads );
+      const auto run = [ & ]( const std::size_t i ) noexcept {
+         try {
+            f( n * i / threads, n * ( i + 1 ) / threads );
+         }
+         catch( ... ) {
+            errors[ i ] = std::current_exception();
+         }
+      };
+      std::vector< std::thread > workers;
+      workers.reserve( threads - 1 );
+      try {
+         for( std::size_t i = 1; i < threads; ++i ) {
+            workers.emplace_back( run, i );
+         }
+      }
+      catch( ... ) {
+         // LCOV_EXCL_START
+         for( auto& worker : workers ) {
+            worker.join();
+         }
+         throw;
+         // LCOV_EXCL_STOP
+      }
+      run( 0 );
+      for( auto& worker : workers ) {
+         worker.join();
+      }
+      for( const auto& error : errors ) {
+         if( error ) {
+            std::rethrow_exception( error );
+         }
+      }
+   }
+
+}  // namespace tao::pq::internal
+
+#endif
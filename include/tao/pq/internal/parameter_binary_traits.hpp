@@ -4,18 +4,33 @@
 #ifndef TAO_PQ_INTERNAL_PARAMETER_BINARY_TRAITS_HPP
 #define TAO_PQ_INTERNAL_PARAMETER_BINARY_TRAITS_HPP
 
+#include <array>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <libpq-fe.h>
 
+#include <tao/pq/decimal.hpp>
+#include <tao/pq/inet.hpp>
+#include <tao/pq/internal/array.hpp>
+#include <tao/pq/internal/chrono.hpp>
 #include <tao/pq/internal/endian.hpp>
 #include <tao/pq/internal/is_bytea_parameter.hpp>
+#include <tao/pq/internal/numeric.hpp>
+#include <tao/pq/internal/parameter_traits.hpp>
+#include <tao/pq/macaddr.hpp>
 #include <tao/pq/span.hpp>
+#include <tao/pq/uuid.hpp>
 
 namespace tao::pq::internal
 {
@@ -351,6 +366,334 @@ namespace tao::pq::internal
       }
    };
 
+   // numeric values, see numeric.hpp for the format
+   class numeric_helper
+   {
+   private:
+      char m_buffer[ numeric_buffer_size ];
+      int m_size;
+
+   protected:
+      explicit numeric_helper( const unsigned long long v ) noexcept;
+      explicit numeric_helper( const decimal& v );
+
+   public:
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return 1700;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return m_buffer;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto length() const noexcept -> int
+      {
+         return m_size;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 1;
+      }
+   };
+
+   // unsigned values are sent as the next wider signed type, 64 bit values as numeric
+
+   template<>
+   struct parameter_binary_traits< unsigned char >
+      : parameter_binary_traits< short >
+   {
+      explicit parameter_binary_traits( const unsigned char v ) noexcept
+         : parameter_binary_traits< short >( v )
+      {}
+   };
+
+   template<>
+   struct parameter_binary_traits< unsigned short >
+      : parameter_binary_traits< int >
+   {
+      explicit parameter_binary_traits( const unsigned short v ) noexcept
+         : parameter_binary_traits< int >( v )
+      {}
+   };
+
+   template<>
+   struct parameter_binary_traits< unsigned >
+      : parameter_binary_traits< long long >
+   {
+      static_assert( sizeof( unsigned ) == 4 );
+
+      explicit parameter_binary_traits( const unsigned v ) noexcept
+         : parameter_binary_traits< long long >( v )
+      {}
+   };
+
+   template<>
+   struct parameter_binary_traits< unsigned long >
+      : std::conditional_t< sizeof( unsigned long ) == 4, parameter_binary_traits< long long >, numeric_helper >
+   {
+      explicit parameter_binary_traits( const unsigned long v ) noexcept
+         : std::conditional_t< sizeof( unsigned long ) == 4, parameter_binary_traits< long long >, numeric_helper >( v )
+      {}
+   };
+
+   template<>
+   struct parameter_binary_traits< unsigned long long >
+      : numeric_helper
+   {
+      explicit parameter_binary_traits( const unsigned long long v ) noexcept
+         : numeric_helper( v )
+      {}
+   };
+
+   template<>
+   struct parameter_binary_traits< decimal >
+      : numeric_helper
+   {
+      explicit parameter_binary_traits( const decimal& v )
+         : numeric_helper( v )
+      {}
+   };
+
+   // time points with a precision of days are sent as date, all others as timestamptz, see chrono.hpp
+   template< typename Duration >
+   struct parameter_binary_traits< std::chrono::time_point< std::chrono::system_clock, Duration > >
+   {
+   private:
+      using value_t = std::conditional_t< is_date< Duration >, std::int32_t, std::int64_t >;
+
+      [[nodiscard]] static auto convert( const std::chrono::time_point< std::chrono::system_clock, Duration > v ) -> value_t
+      {
+         if constexpr( is_date< Duration > ) {
+            const std::int64_t days = static_cast< std::int64_t >( v.time_since_epoch().count() ) - postgres_epoch_days;
+            if( ( days < std::numeric_limits< std::int32_t >::min() ) || ( days > std::numeric_limits< std::int32_t >::max() ) ) {
+               throw chrono_overflow( "date" );
+            }
+            return static_cast< value_t >( days );
+         }
+         else {
+            return to_postgres_microseconds( v );
+         }
+      }
+
+      const value_t m_v;
+
+   public:
+      explicit parameter_binary_traits( const std::chrono::time_point< std::chrono::system_clock, Duration > v )
+         : m_v( hton( convert( v ) ) )
+      {}
+
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return is_date< Duration > ? 1082 : 1184;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return reinterpret_cast< const char* >( &m_v );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto length() noexcept -> int
+      {
+         return sizeof( value_t );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 1;
+      }
+   };
+
+   // sent as an interval of microseconds, without days and months
+   template< typename Rep, typename Period >
+   struct parameter_binary_traits< std::chrono::duration< Rep, Period > >
+   {
+   private:
+      char m_buffer[ 16 ] = {};
+
+   public:
+      explicit parameter_binary_traits( const std::chrono::duration< Rep, Period > v )
+      {
+         const std::int64_t microseconds = hton( to_microseconds( v ) );
+         std::memcpy( m_buffer, &microseconds, sizeof( microseconds ) );
+      }
+
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return 1186;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return m_buffer;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto length() noexcept -> int
+      {
+         return sizeof( m_buffer );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 1;
+      }
+   };
+
+#if defined( TAO_PQ_USE_CALENDAR )
+   template<>
+   struct parameter_binary_traits< std::chrono::year_month_day >
+      : parameter_binary_traits< std::chrono::sys_days >
+   {
+      explicit parameter_binary_traits( const std::chrono::year_month_day v )
+         : parameter_binary_traits< std::chrono::sys_days >( internal::to_sys_days( v ) )
+      {}
+   };
+#endif
+
+   // values which are sent as the bytes they store, i.e. uuid and macaddr
+   template< typename T, Oid Type >
+   class bytes_helper
+   {
+   private:
+      const T m_v;
+
+   protected:
+      explicit bytes_helper( const T& v ) noexcept
+         : m_v( v )
+      {}
+
+   public:
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return Type;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return reinterpret_cast< const char* >( m_v.bytes.data() );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto length() noexcept -> int
+      {
+         return static_cast< int >( std::tuple_size_v< decltype( T::bytes ) > );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 1;
+      }
+   };
+
+   template<>
+   struct parameter_binary_traits< uuid >
+      : bytes_helper< uuid, 2950 >
+   {
+      explicit parameter_binary_traits( const uuid& v ) noexcept
+         : bytes_helper( v )
+      {}
+   };
+
+   template<>
+   struct parameter_binary_traits< macaddr >
+      : bytes_helper< macaddr, 829 >
+   {
+      explicit parameter_binary_traits( const macaddr& v ) noexcept
+         : bytes_helper( v )
+      {}
+   };
+
+   // inet and cidr values: family, bits, is_cidr, and the number of address bytes, followed by the address
+   template< Oid Type >
+   class inet_helper
+   {
+   private:
+      char m_buffer[ 4 + 16 ];
+
+   protected:
+      explicit inet_helper( const inet& v )
+      {
+         if( v.bits > v.max_bits() ) {
+            throw std::invalid_argument( "invalid netmask in tao::pq::inet: " + std::to_string( v.bits ) + " bits" );
+         }
+         m_buffer[ 0 ] = ( v.family == inet::family_type::ipv4 ) ? 2 : 3;
+         m_buffer[ 1 ] = static_cast< char >( v.bits );
+         m_buffer[ 2 ] = ( Type == 650 ) ? 1 : 0;
+         m_buffer[ 3 ] = static_cast< char >( v.size() );
+         std::memcpy( m_buffer + 4, v.address.data(), v.size() );
+      }
+
+   public:
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return Type;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return m_buffer;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto length() const noexcept -> int
+      {
+         return 4 + m_buffer[ 3 ];
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 1;
+      }
+   };
+
+   template<>
+   struct parameter_binary_traits< inet >
+      : inet_helper< 869 >
+   {
+      explicit parameter_binary_traits( const inet& v )
+         : inet_helper( v )
+      {}
+   };
+
+   template<>
+   struct parameter_binary_traits< cidr >
+      : inet_helper< 650 >
+   {
+      explicit parameter_binary_traits( const cidr& v )
+         : inet_helper( ( v.validate(), v ) )
+      {}
+   };
+
    template<>
    struct parameter_binary_traits< std::string_view >
    {
@@ -437,6 +780,136 @@ namespace tao::pq::internal
       }
    };
 
+   // containers of bytes are sent as bytea, just like spans of bytes
+   template< typename T, typename A >
+   struct parameter_binary_traits< std::vector< T, A >, std::enable_if_t< is_bytea_parameter< T >::value > >
+      : parameter_binary_traits< tao::span< const T > >
+   {
+      explicit parameter_binary_traits( const std::vector< T, A >& v ) noexcept
+         : parameter_binary_traits< tao::span< const T > >( tao::span< const T >( v.data(), v.size() ) )
+      {}
+   };
+
+   template< typename T, std::size_t N >
+   struct parameter_binary_traits< std::array< T, N >, std::enable_if_t< is_bytea_parameter< T >::value > >
+      : parameter_binary_traits< tao::span< const T > >
+   {
+      explicit parameter_binary_traits( const std::array< T, N >& v ) noexcept
+         : parameter_binary_traits< tao::span< const T > >( tao::span< const T >( v.data(), v.size() ) )
+      {}
+   };
+
+   // vectors, arrays and spans are sent as arrays, nested containers as multidimensional arrays, see array.hpp
+   template< typename T >
+   struct parameter_binary_traits< T, std::enable_if_t< is_array_parameter< T > > >
+   {
+   private:
+      using element_t = parameter_traits< internal::parameter_binary_traits, typename array_traits< T >::element_type >;
+      static_assert( element_t::columns == 1, "array elements must be sent as a single value" );
+
+      // elements which are sent as text, e.g. const char*, are embedded as text
+      static constexpr bool is_text = ( element_t::template format< 0 >() == 0 );
+      static constexpr Oid element_oid = is_text ? 25 : element_t::template type< 0 >();
+      static_assert( is_text ? ( element_t::template type< 0 >() == 0 ) : ( array_oid( element_oid ) != 0 ), "array element type has no known array type" );
+
+      static constexpr std::size_t dimensions = array_traits< T >::dimensions;
+
+      std::string m_buffer;
+
+      // the sizes of nested containers are taken from their first elements
+      template< typename U >
+      static void sizes( std::size_t* nrv, const U& v ) noexcept
+      {
+         *nrv = v.size();
+         if constexpr( is_array_parameter< typename U::value_type > ) {
+            if( v.size() != 0 ) {
+               sizes( nrv + 1, *v.begin() );
+            }
+         }
+      }
+
+      template< typename U >
+      void append( const U& v, const std::size_t* size, bool& has_null )
+      {
+         if( v.size() != *size ) {
+            throw std::invalid_argument( "multidimensional arrays must have nested containers with matching sizes" );
+         }
+         for( const auto& e : v ) {
+            if constexpr( is_array_parameter< std::decay_t< decltype( e ) > > ) {
+               append( e, size + 1, has_null );
+            }
+            else {
+               const element_t t( e );
+               const char* p = t.template value< 0 >();
+               if( p == nullptr ) {
+                  has_null = true;
+                  append_array_int32( m_buffer, -1 );
+               }
+               else {
+                  const auto n = is_text ? std::strlen( p ) : static_cast< std::size_t >( t.template length< 0 >() );
+                  append_array_int32( m_buffer, static_cast< std::int32_t >( n ) );
+                  m_buffer.append( p, n );
+               }
+            }
+         }
+      }
+
+   public:
+      explicit parameter_binary_traits( const T& v )
+      {
+         std::size_t size[ dimensions ] = {};
+         sizes( size, v );
+         bool empty = false;
+         for( const auto n : size ) {
+            if( n > static_cast< std::size_t >( std::numeric_limits< std::int32_t >::max() ) ) {
+               throw std::length_error( "array too large" );
+            }
+            empty = empty || ( n == 0 );
+         }
+         // an empty array has no dimensions
+         append_array_int32( m_buffer, empty ? 0 : static_cast< std::int32_t >( dimensions ) );
+         append_array_int32( m_buffer, 0 );
+         append_array_int32( m_buffer, static_cast< std::int32_t >( element_oid ) );
+         if( !empty ) {
+            for( const auto n : size ) {
+               append_array_int32( m_buffer, static_cast< std::int32_t >( n ) );
+               append_array_int32( m_buffer, 1 );
+            }
+            bool has_null = false;
+            append( v, size, has_null );
+            if( has_null ) {
+               m_buffer[ 7 ] = 1;
+            }
+         }
+      }
+
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return array_oid( element_oid );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return m_buffer.data();
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto length() const noexcept -> int
+      {
+         return static_cast< int >( m_buffer.size() );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 1;
+      }
+   };
+
 }  // namespace tao::pq::internal
 
 #endif
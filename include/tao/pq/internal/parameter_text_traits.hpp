@@ -4,33 +4,30 @@
 #ifndef TAO_PQ_INTERNAL_PARAMETER_TEXT_TRAITS_HPP
 #define TAO_PQ_INTERNAL_PARAMETER_TEXT_TRAITS_HPP
 
-#include <cmath>
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
+#include <tao/pq/decimal.hpp>
+#include <tao/pq/inet.hpp>
+#include <tao/pq/internal/array.hpp>
+#include <tao/pq/internal/chrono.hpp>
 #include <tao/pq/internal/is_bytea_parameter.hpp>
+#include <tao/pq/internal/parameter_traits.hpp>
 #include <tao/pq/internal/parameter_traits_helper.hpp>
-#include <tao/pq/internal/printf.hpp>
+#include <tao/pq/macaddr.hpp>
 #include <tao/pq/span.hpp>
+#include <tao/pq/uuid.hpp>
 
 #include <libpq-fe.h>
 
 namespace tao::pq::internal
 {
-   template< typename T >
-   [[nodiscard]] auto printf_helper( const char* format, const T v ) -> std::string
-   {
-      if( std::isfinite( v ) ) {
-         return printf( format, v );
-      }
-      if( std::isnan( v ) ) {
-         return "NAN";
-      }
-      return ( v < 0 ) ? "-INF" : "INF";
-   }
-
    template< typename T, typename = void >
    struct parameter_text_traits
    {
@@ -83,118 +80,118 @@ namespace tao::pq::internal
 
    template<>
    struct parameter_text_traits< signed char >
-      : string_helper
+      : to_chars_helper< signed char >
    {
-      parameter_text_traits( const signed char v )
-         : string_helper( printf( "%hhd", v ) )
+      parameter_text_traits( const signed char v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< unsigned char >
-      : string_helper
+      : to_chars_helper< unsigned char >
    {
-      parameter_text_traits( const unsigned char v )
-         : string_helper( printf( "%hhu", v ) )
+      parameter_text_traits( const unsigned char v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< short >
-      : string_helper
+      : to_chars_helper< short >
    {
-      parameter_text_traits( const short v )
-         : string_helper( printf( "%hd", v ) )
+      parameter_text_traits( const short v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< unsigned short >
-      : string_helper
+      : to_chars_helper< unsigned short >
    {
-      parameter_text_traits( const unsigned short v )
-         : string_helper( printf( "%hu", v ) )
+      parameter_text_traits( const unsigned short v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< int >
-      : string_helper
+      : to_chars_helper< int >
    {
-      parameter_text_traits( const int v )
-         : string_helper( printf( "%d", v ) )
+      parameter_text_traits( const int v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< unsigned >
-      : string_helper
+      : to_chars_helper< unsigned >
    {
-      parameter_text_traits( const unsigned v )
-         : string_helper( printf( "%u", v ) )
+      parameter_text_traits( const unsigned v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< long >
-      : string_helper
+      : to_chars_helper< long >
    {
-      parameter_text_traits( const long v )
-         : string_helper( printf( "%ld", v ) )
+      parameter_text_traits( const long v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< unsigned long >
-      : string_helper
+      : to_chars_helper< unsigned long >
    {
-      parameter_text_traits( const unsigned long v )
-         : string_helper( printf( "%lu", v ) )
+      parameter_text_traits( const unsigned long v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< long long >
-      : string_helper
+      : to_chars_helper< long long >
    {
-      parameter_text_traits( const long long v )
-         : string_helper( printf( "%lld", v ) )
+      parameter_text_traits( const long long v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< unsigned long long >
-      : string_helper
+      : to_chars_helper< unsigned long long >
    {
-      parameter_text_traits( const unsigned long long v )
-         : string_helper( printf( "%llu", v ) )
+      parameter_text_traits( const unsigned long long v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< float >
-      : string_helper
+      : to_chars_helper< float >
    {
-      parameter_text_traits( const float v )
-         : string_helper( printf_helper( "%.9g", v ) )
+      parameter_text_traits( const float v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< double >
-      : string_helper
+      : to_chars_helper< double >
    {
-      parameter_text_traits( const double v )
-         : string_helper( printf_helper( "%.17g", v ) )
+      parameter_text_traits( const double v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
    template<>
    struct parameter_text_traits< long double >
-      : string_helper
+      : to_chars_helper< long double >
    {
-      parameter_text_traits( const long double v )
-         : string_helper( printf_helper( "%.21Lg", v ) )
+      parameter_text_traits( const long double v ) noexcept
+         : to_chars_helper( v )
       {}
    };
 
@@ -207,6 +204,131 @@ namespace tao::pq::internal
       {}
    };
 
+   template<>
+   struct parameter_text_traits< decimal >
+      : string_helper
+   {
+      explicit parameter_text_traits( const decimal& v )
+         : string_helper( v.to_string() )
+      {}
+   };
+
+   template<>
+   struct parameter_text_traits< uuid >
+      : string_helper
+   {
+      explicit parameter_text_traits( const uuid& v )
+         : string_helper( v.to_string() )
+      {}
+   };
+
+   template<>
+   struct parameter_text_traits< macaddr >
+      : string_helper
+   {
+      explicit parameter_text_traits( const macaddr& v )
+         : string_helper( v.to_string() )
+      {}
+   };
+
+   template<>
+   struct parameter_text_traits< inet >
+      : string_helper
+   {
+      explicit parameter_text_traits( const inet& v )
+         : string_helper( v.to_string() )
+      {}
+   };
+
+   template<>
+   struct parameter_text_traits< cidr >
+      : string_helper
+   {
+      explicit parameter_text_traits( const cidr& v )
+         : string_helper( ( v.validate(), v.to_string() ) )
+      {}
+   };
+
+   // formats dates, timestamps and intervals into an inline buffer, see chrono.hpp
+   template< Oid Type >
+   class chrono_text_helper
+   {
+   private:
+      char m_buffer[ chrono_buffer_size ];
+
+   protected:
+      chrono_text_helper() noexcept = default;
+
+      [[nodiscard]] auto buffer() noexcept -> char*
+      {
+         return m_buffer;
+      }
+
+   public:
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return Type;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return m_buffer;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto length() noexcept -> int
+      {
+         return 0;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 0;
+      }
+   };
+
+   // time points with a precision of days are sent as date, all others as timestamptz in UTC
+   template< typename Duration >
+   struct parameter_text_traits< std::chrono::time_point< std::chrono::system_clock, Duration > >
+      : chrono_text_helper< is_date< Duration > ? 1082 : 1184 >
+   {
+      explicit parameter_text_traits( const std::chrono::time_point< std::chrono::system_clock, Duration > v )
+      {
+         if constexpr( is_date< Duration > ) {
+            (void)format_date( this->buffer(), static_cast< std::int64_t >( v.time_since_epoch().count() ) - postgres_epoch_days );
+         }
+         else {
+            (void)format_timestamp( this->buffer(), to_postgres_microseconds( v ) );
+         }
+      }
+   };
+
+   template< typename Rep, typename Period >
+   struct parameter_text_traits< std::chrono::duration< Rep, Period > >
+      : chrono_text_helper< 1186 >
+   {
+      explicit parameter_text_traits( const std::chrono::duration< Rep, Period > v )
+      {
+         (void)format_interval( this->buffer(), to_microseconds( v ) );
+      }
+   };
+
+#if defined( TAO_PQ_USE_CALENDAR )
+   template<>
+   struct parameter_text_traits< std::chrono::year_month_day >
+      : parameter_text_traits< std::chrono::sys_days >
+   {
+      explicit parameter_text_traits( const std::chrono::year_month_day v )
+         : parameter_text_traits< std::chrono::sys_days >( internal::to_sys_days( v ) )
+      {}
+   };
+#endif
+
    template< typename ElementType, std::size_t Extent >
    struct parameter_text_traits< tao::span< ElementType, Extent >, std::enable_if_t< is_bytea_parameter< ElementType >::value > >  // NOLINT(cppcoreguidelines-special-member-functions)
    {
@@ -254,6 +376,74 @@ namespace tao::pq::internal
       }
    };
 
+   // containers of bytes are sent as bytea, just like spans of bytes
+   template< typename T, typename A >
+   struct parameter_text_traits< std::vector< T, A >, std::enable_if_t< is_bytea_parameter< T >::value > >
+      : parameter_text_traits< tao::span< const T > >
+   {
+      parameter_text_traits( PGconn* c, const std::vector< T, A >& v )
+         : parameter_text_traits< tao::span< const T > >( c, tao::span< const T >( v.data(), v.size() ) )
+      {}
+   };
+
+   template< typename T, std::size_t N >
+   struct parameter_text_traits< std::array< T, N >, std::enable_if_t< is_bytea_parameter< T >::value > >
+      : parameter_text_traits< tao::span< const T > >
+   {
+      parameter_text_traits( PGconn* c, const std::array< T, N >& v )
+         : parameter_text_traits< tao::span< const T > >( c, tao::span< const T >( v.data(), v.size() ) )
+      {}
+   };
+
+   // vectors, arrays and spans are sent as arrays, nested containers as multidimensional arrays, see array.hpp
+   template< typename T >
+   struct parameter_text_traits< T, std::enable_if_t< is_array_parameter< T > > >
+      : string_helper
+   {
+   private:
+      using element_t = parameter_traits< internal::parameter_text_traits, typename array_traits< T >::element_type >;
+      static_assert( element_t::columns == 1, "array elements must be sent as a single value" );
+
+      template< typename U >
+      static void append( std::string& buffer, const U& v )
+      {
+         buffer += '{';
+         bool first = true;
+         for( const auto& e : v ) {
+            if( !first ) {
+               buffer += ',';
+            }
+            first = false;
+            if constexpr( is_array_parameter< std::decay_t< decltype( e ) > > ) {
+               append( buffer, e );
+            }
+            else {
+               append_array_element( buffer, element_t( e ).template value< 0 >() );
+            }
+         }
+         buffer += '}';
+      }
+
+      [[nodiscard]] static auto to_string( const T& v ) -> std::string
+      {
+         std::string nrv;
+         append( nrv, v );
+         return nrv;
+      }
+
+   public:
+      explicit parameter_text_traits( const T& v )
+         : string_helper( to_string( v ) )
+      {}
+
+      // unknown element types leave the array's type to be inferred by the server, e.g. from "WHERE id = ANY( $1 )"
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return array_oid( element_t::template type< 0 >() );
+      }
+   };
+
 }  // namespace tao::pq::internal
 
 #endif
@@ -4,12 +4,24 @@
 #ifndef TAO_PQ_INTERNAL_PARAMETER_TRAITS_HELPER_HPP
 #define TAO_PQ_INTERNAL_PARAMETER_TRAITS_HELPER_HPP
 
+#include <cassert>
+#include <charconv>
+#include <cmath>
 #include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <system_error>
+#include <type_traits>
 #include <utility>
 
 #include <libpq-fe.h>
 
+#if !defined( TAO_PQ_USE_FLOATING_POINT_TO_CHARS ) && defined( __cpp_lib_to_chars )
+#define TAO_PQ_USE_FLOATING_POINT_TO_CHARS
+#endif
+
 namespace tao::pq::internal
 {
    class char_pointer_helper
@@ -89,6 +101,97 @@ namespace tao::pq::internal
       }
    };
 
+   // formats arithmetic values into an inline buffer, avoiding any allocation
+   template< typename T >
+   class to_chars_helper
+   {
+   private:
+      static_assert( std::is_arithmetic_v< T > );
+
+      // sign, digits, decimal point, exponent, and the terminating zero
+      static constexpr std::size_t buffer_size = std::is_floating_point_v< T > ? ( std::numeric_limits< T >::max_digits10 + 12 ) : ( std::numeric_limits< T >::digits10 + 3 );
+
+      char m_buffer[ buffer_size ];
+      int m_size;
+
+      void assign( const char* s ) noexcept
+      {
+         m_size = static_cast< int >( std::strlen( s ) );
+         std::memcpy( m_buffer, s, m_size + 1 );
+      }
+
+   protected:
+      explicit to_chars_helper( const T v ) noexcept
+      {
+         if constexpr( std::is_floating_point_v< T > ) {
+            if( !std::isfinite( v ) ) {
+               if( std::isnan( v ) ) {
+                  assign( "NAN" );
+               }
+               else {
+                  assign( ( v < 0 ) ? "-INF" : "INF" );
+               }
+               return;
+            }
+         }
+#if !defined( TAO_PQ_USE_FLOATING_POINT_TO_CHARS )
+         if constexpr( std::is_floating_point_v< T > ) {
+            // no std::to_chars() for floating point values, fall back to the precision needed for a round-trip
+            if constexpr( std::is_same_v< T, long double > ) {
+               m_size = std::snprintf( m_buffer, buffer_size, "%.*Lg", std::numeric_limits< T >::max_digits10, v );
+            }
+            else {
+               m_size = std::snprintf( m_buffer, buffer_size, "%.*g", std::numeric_limits< T >::max_digits10, static_cast< double >( v ) );
+            }
+            assert( ( m_size > 0 ) && ( static_cast< std::size_t >( m_size ) < buffer_size ) );
+         }
+         else
+#endif
+         {
+            // shortest representation which round-trips for floating point values
+            const auto [ end, ec ] = std::to_chars( m_buffer, m_buffer + buffer_size - 1, v );
+            assert( ec == std::errc() );
+            (void)ec;
+            *end = '\0';
+            m_size = static_cast< int >( end - m_buffer );
+         }
+      }
+
+   public:
+      to_chars_helper( const to_chars_helper& ) = delete;
+      to_chars_helper( to_chars_helper&& ) = delete;
+      ~to_chars_helper() = default;
+
+      void operator=( const to_chars_helper& ) = delete;
+      void operator=( to_chars_helper&& ) = delete;
+
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> Oid
+      {
+         return 0;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return m_buffer;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto length() const noexcept -> int
+      {
+         return m_size;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 0;
+      }
+   };
+
 }  // namespace tao::pq::internal
 
 #endif
@@ -0,0 +1,28 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_POLL_HPP
+#define TAO_PQ_INTERNAL_POLL_HPP
+
+#include <vector>
+
+#include <tao/pq/poll.hpp>
+
+namespace tao::pq::internal
+{
+   // waits until the socket is ready as requested, a negative timeout (in milliseconds) waits forever, returns false on timeout
+   [[nodiscard]] auto poll( const int socket, const poll_status status, const int timeout = -1 ) -> bool;
+
+   struct poll_request
+   {
+      int socket;
+      poll_status status;
+      bool ready;
+   };
+
+   // waits until at least one of the sockets is ready and marks all ready ones, a negative timeout waits forever, returns false on timeout
+   [[nodiscard]] auto poll( std::vector< poll_request >& requests, const int timeout = -1 ) -> bool;
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -88,14 +88,20 @@ namespace tao::pq::internal
          d->m_pool.reset();
       }
 
+      // take ownership of a T which is put into the pool when no longer used
+      [[nodiscard]] auto adopt( std::unique_ptr< T >&& up ) -> std::shared_ptr< T >
+      {
+         return { up.release(), deleter( this->weak_from_this() ) };
+      }
+
       // create a new T which is put into the pool when no longer used
       [[nodiscard]] auto create() -> std::shared_ptr< T >
       {
-         return { v_create().release(), deleter( this->weak_from_this() ) };
+         return adopt( v_create() );
       }
 
-      // get an instance from the pool or create a new one if necessary
-      [[nodiscard]] auto get() -> std::shared_ptr< T >
+      // get a valid instance from the pool, nullptr if there is none
+      [[nodiscard]] auto try_get() -> std::shared_ptr< T >
       {
          while( const auto sp = pull() ) {
             if( v_is_valid( *sp ) ) {
@@ -103,6 +109,15 @@ namespace tao::pq::internal
                return sp;
             }
          }
+         return nullptr;
+      }
+
+      // get an instance from the pool or create a new one if necessary
+      [[nodiscard]] auto get() -> std::shared_ptr< T >
+      {
+         if( auto sp = try_get() ) {
+            return sp;
+         }
          return create();
       }
 
@@ -0,0 +1,60 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_PREPARED_CACHE_HPP
+#define TAO_PQ_INTERNAL_PREPARED_CACHE_HPP
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <libpq-fe.h>
+
+namespace tao::pq::internal
+{
+   // bookkeeping for automatically prepared statements, a bounded LRU keyed by the statement's text,
+   // looked up by std::string_view so that executing a known statement does not allocate
+   class prepared_cache
+   {
+   public:
+      struct entry
+      {
+         std::string key;
+         std::vector< Oid > types;  // fixed when preparing
+         std::size_t count = 0;
+         std::string name;  // empty while the statement is not prepared
+      };
+
+   private:
+      const std::size_t m_capacity;
+      const std::size_t m_threshold;
+      std::size_t m_next_id = 0;
+
+      std::list< entry > m_entries;  // most recently used first
+      std::unordered_map< std::string_view, std::list< entry >::iterator > m_index;
+
+   public:
+      prepared_cache( const std::size_t capacity, const std::size_t threshold );
+
+      [[nodiscard]] auto threshold() const noexcept -> std::size_t
+      {
+         return m_threshold;
+      }
+
+      // finds or adds the entry for key and marks it as most recently used, an entry with different parameter types is reset,
+      // the names of evicted prepared statements are appended to evicted
+      [[nodiscard]] auto use( const std::string_view key, const int n_params, const Oid types[], std::vector< std::string >& evicted ) -> entry&;
+
+      // a new name for a statement about to be prepared
+      [[nodiscard]] auto next_name() -> std::string;
+
+      // removes all entries, returns the names of the prepared statements
+      [[nodiscard]] auto clear() -> std::vector< std::string >;
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,129 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_INTERNAL_SNAPSHOT_HPP
+#define TAO_PQ_INTERNAL_SNAPSHOT_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <libpq-fe.h>
+
+namespace tao::pq::internal
+{
+   // a result set stored in a single contiguous block, which is position independent and can therefore be
+   // written to a file and memory-mapped back, all integers use the native byte order and are read with memcpy()
+   //
+   //   header         magic, byte order mark, version, columns, rows and size of the value area
+   //   column table   per column: offset of the name in the value area, format and type
+   //   offsets        per field plus one: offset of the value in the value area, in row-major order
+   //   null bitmap    per field: one bit, padded to a multiple of eight bytes
+   //   value area     PQcmdTuples(), the column names and the values, each followed by a terminating zero
+   class snapshot
+   {
+   private:
+      std::shared_ptr< const void > m_owner;
+      const char* m_data;
+      std::size_t m_size;
+      std::size_t m_columns;
+      std::size_t m_rows;
+      const char* m_column_table;
+      const char* m_offsets;
+      const unsigned char* m_nulls;
+      const char* m_values;
+
+      [[nodiscard]] static auto load( const char* data ) noexcept -> std::uint64_t
+      {
+         std::uint64_t nrv;
+         std::memcpy( &nrv, data, sizeof( nrv ) );
+         return nrv;
+      }
+
+      [[nodiscard]] auto offset( const std::size_t field ) const noexcept -> std::size_t
+      {
+         return static_cast< std::size_t >( load( m_offsets + field * sizeof( std::uint64_t ) ) );
+      }
+
+      [[nodiscard]] auto field( const std::size_t row, const std::size_t column ) const noexcept -> std::size_t
+      {
+         assert( ( row < m_rows ) && ( column < m_columns ) );
+         return row * m_columns + column;
+      }
+
+   public:
+      static constexpr std::size_t header_size = 48;
+      static constexpr std::size_t column_size = 16;
+
+      // validates the structure, but not the values themselves, data must remain valid as long as owner is referenced
+      snapshot( std::shared_ptr< const void > owner, const char* data, const std::size_t size );
+
+      [[nodiscard]] static auto serialize( const PGresult* pgresult ) -> std::string;
+
+      [[nodiscard]] auto bytes() const noexcept -> std::string_view
+      {
+         return std::string_view( m_data, m_size );
+      }
+
+      [[nodiscard]] auto columns() const noexcept -> std::size_t
+      {
+         return m_columns;
+      }
+
+      [[nodiscard]] auto rows() const noexcept -> std::size_t
+      {
+         return m_rows;
+      }
+
+      [[nodiscard]] auto cmd_tuples() const noexcept -> const char*
+      {
+         return m_values;
+      }
+
+      [[nodiscard]] auto name( const std::size_t column ) const noexcept -> const char*
+      {
+         assert( column < m_columns );
+         return m_values + load( m_column_table + column * column_size );
+      }
+
+      [[nodiscard]] auto is_binary( const std::size_t column ) const noexcept -> bool
+      {
+         assert( column < m_columns );
+         std::uint32_t format;
+         std::memcpy( &format, m_column_table + column * column_size + 8, sizeof( format ) );
+         return format == 1;
+      }
+
+      [[nodiscard]] auto type( const std::size_t column ) const noexcept -> Oid
+      {
+         assert( column < m_columns );
+         std::uint32_t nrv;
+         std::memcpy( &nrv, m_column_table + column * column_size + 12, sizeof( nrv ) );
+         return static_cast< Oid >( nrv );
+      }
+
+      [[nodiscard]] auto is_null( const std::size_t row, const std::size_t column ) const noexcept -> bool
+      {
+         const std::size_t i = field( row, column );
+         return ( ( m_nulls[ i / 8 ] >> ( i % 8 ) ) & 1U ) != 0;
+      }
+
+      [[nodiscard]] auto get( const std::size_t row, const std::size_t column ) const noexcept -> const char*
+      {
+         return m_values + offset( field( row, column ) );
+      }
+
+      [[nodiscard]] auto length( const std::size_t row, const std::size_t column ) const noexcept -> std::size_t
+      {
+         const std::size_t i = field( row, column );
+         return offset( i + 1 ) - offset( i ) - 1;
+      }
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,42 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_MACADDR_HPP
+#define TAO_PQ_MACADDR_HPP
+
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace tao::pq
+{
+   // the six bytes of a macaddr column
+   struct macaddr
+   {
+      std::array< unsigned char, 6 > bytes{};
+
+      // accepts the formats of PostgreSQL's macaddr input, e.g. "08:00:2b:01:02:03", "08-00-2b-01-02-03", "08002b:010203", or "0800.2b01.0203"
+      [[nodiscard]] static auto from_string( const std::string_view value ) -> macaddr;
+
+      // the canonical text format, e.g. "08:00:2b:01:02:03"
+      [[nodiscard]] auto to_string() const -> std::string;
+
+      [[nodiscard]] friend auto operator==( const macaddr& lhs, const macaddr& rhs ) noexcept
+      {
+         return lhs.bytes == rhs.bytes;
+      }
+
+      [[nodiscard]] friend auto operator!=( const macaddr& lhs, const macaddr& rhs ) noexcept
+      {
+         return lhs.bytes != rhs.bytes;
+      }
+
+      [[nodiscard]] friend auto operator<( const macaddr& lhs, const macaddr& rhs ) noexcept
+      {
+         return lhs.bytes < rhs.bytes;
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,52 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_NOTIFICATION_HPP
+#define TAO_PQ_NOTIFICATION_HPP
+
+#include <memory>
+
+#include <libpq-fe.h>
+
+namespace tao::pq
+{
+   class connection;
+
+   // a message sent with NOTIFY to a channel the connection is listening on
+   class notification final
+   {
+   private:
+      friend class connection;
+
+      std::unique_ptr< PGnotify, decltype( &PQfreemem ) > m_pgnotify;
+
+      explicit notification( PGnotify* pgnotify ) noexcept
+         : m_pgnotify( pgnotify, &PQfreemem )
+      {}
+
+   public:
+      [[nodiscard]] auto channel() const noexcept -> const char*
+      {
+         return m_pgnotify->relname;
+      }
+
+      [[nodiscard]] auto payload() const noexcept -> const char*
+      {
+         return m_pgnotify->extra;
+      }
+
+      // the process id of the server process which sent the notification
+      [[nodiscard]] auto pid() const noexcept -> int
+      {
+         return m_pgnotify->be_pid;
+      }
+
+      [[nodiscard]] auto underlying_raw_ptr() const noexcept -> const PGnotify*
+      {
+         return m_pgnotify.get();
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
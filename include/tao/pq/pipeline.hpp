@@ -0,0 +1,137 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_PIPELINE_HPP
+#define TAO_PQ_PIPELINE_HPP
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/parameter_traits.hpp>
+#include <tao/pq/result.hpp>
+#include <tao/pq/result_format.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   class connection;
+   class pipeline;
+
+   class deferred_result
+   {
+   private:
+      friend class pipeline;
+
+      std::shared_ptr< pipeline > m_pipeline;
+      std::size_t m_index;
+
+      deferred_result( const std::shared_ptr< pipeline >& pipeline, const std::size_t index ) noexcept  // NOLINT(modernize-pass-by-value)
+         : m_pipeline( pipeline ),
+           m_index( index )
+      {}
+
+   public:
+      [[nodiscard]] auto index() const noexcept -> std::size_t
+      {
+         return m_index;
+      }
+
+      // waits for the result if necessary, may only be called once
+      [[nodiscard]] auto get() const -> result;
+   };
+
+   class pipeline final
+      : public transaction
+   {
+   private:
+      friend class deferred_result;
+
+      const std::shared_ptr< transaction > m_previous;
+
+      std::size_t m_queued;   // statements sent
+      std::size_t m_flushed;  // statements covered by a sync point or a flush request
+      std::size_t m_synced;   // statements covered by a sync point
+      std::size_t m_fetched;  // results received
+      std::size_t m_syncs;    // sync points not yet confirmed by the server
+
+      // results which were received but not yet claimed by their deferred_result
+      std::map< std::size_t, std::unique_ptr< PGresult, decltype( &PQclear ) > > m_results;
+
+      [[nodiscard]] auto v_is_direct() const noexcept -> bool override
+      {
+         return false;
+      }
+
+      void v_commit() override;
+      void v_rollback() override;
+      void v_reset() noexcept override;
+
+      [[nodiscard]] auto queued() -> deferred_result;
+      void fetch();
+      void drain();
+      [[nodiscard]] auto claim( const std::size_t index ) -> result;
+
+      // the regular interface is not available while pipelining, use enqueue() instead
+      using transaction::async_execute;
+      using transaction::cursor;
+      using transaction::execute;
+      using transaction::get_result;
+      using transaction::send;
+      using transaction::stream;
+      using transaction::subtransaction;
+
+   public:
+      // pass-key idiom
+      class private_key
+      {
+         private_key() = default;
+         friend auto transaction::pipeline() -> std::shared_ptr< pq::pipeline >;
+      };
+
+      pipeline( const private_key& /*unused*/, const std::shared_ptr< pq::connection >& connection );
+      ~pipeline() override;
+
+      pipeline( const pipeline& ) = delete;
+      pipeline( pipeline&& ) = delete;
+      void operator=( const pipeline& ) = delete;
+      void operator=( pipeline&& ) = delete;
+
+      // queue a statement, the result is available through the returned handle
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto enqueue( const char* statement, As&&... as ) -> deferred_result
+      {
+         send< Traits, Format >( statement, std::forward< As >( as )... );
+         return queued();
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto enqueue( const std::string& statement, As&&... as ) -> deferred_result
+      {
+         return enqueue< Traits, Format >( statement.c_str(), std::forward< As >( as )... );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto enqueue( const prepared_statement& statement, As&&... as ) -> deferred_result
+      {
+         send< Traits, Format >( statement, std::forward< As >( as )... );
+         return queued();
+      }
+
+      // mark a sync point, all statements queued so far are sent to the server
+      void sync();
+
+      // wait for all outstanding results and leave pipeline mode
+      void finish()
+      {
+         commit();
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,19 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_POLL_HPP
+#define TAO_PQ_POLL_HPP
+
+namespace tao::pq
+{
+   // what an asynchronous operation waits for before it can make progress
+   enum class poll_status
+   {
+      ready,
+      wait_readable,
+      wait_writable
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,46 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_PREPARED_STATEMENT_HPP
+#define TAO_PQ_PREPARED_STATEMENT_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
+
+namespace tao::pq
+{
+   class connection;
+
+   // a statement prepared with connection::prepare(), executing it skips the lookup by name
+   class prepared_statement
+   {
+   private:
+      friend class connection;
+
+      std::string m_name;
+      std::vector< Oid > m_types;
+
+      prepared_statement( std::string name, std::vector< Oid > types ) noexcept
+         : m_name( std::move( name ) ),
+           m_types( std::move( types ) )
+      {}
+
+   public:
+      [[nodiscard]] auto name() const noexcept -> const std::string&
+      {
+         return m_name;
+      }
+
+      // the parameter types declared when preparing, unspecified types are 0
+      [[nodiscard]] auto types() const noexcept -> const std::vector< Oid >&
+      {
+         return m_types;
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
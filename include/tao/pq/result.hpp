@@ -4,6 +4,10 @@
 #ifndef TAO_PQ_RESULT_HPP
 #define TAO_PQ_RESULT_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <list>
 #include <map>
 #include <memory>
@@ -11,7 +15,9 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -19,36 +25,156 @@
 
 #include <libpq-fe.h>
 
+#include <tao/pq/internal/demangle.hpp>
+#include <tao/pq/internal/parallel_for.hpp>
 #include <tao/pq/internal/printf.hpp>
+#include <tao/pq/internal/snapshot.hpp>
+#include <tao/pq/result_binary_traits.hpp>
+#include <tao/pq/result_traits.hpp>
 #include <tao/pq/row.hpp>
+#include <tao/pq/span.hpp>
 
 namespace tao::pq
 {
    class connection;
+   class cursor;
+   class pipeline;
+   class result_stream;
    class table_writer;
 
    namespace internal
    {
+      class column_index;
+
       template< typename T, typename = void >
       inline constexpr bool has_reserve = false;
 
       template< typename T >
-      inline constexpr bool has_reserve< T, std::void_t< decltype( T::reserve( std::declval< typename T::size_type >() ) ) > > = true;
+      inline constexpr bool has_reserve< T, std::void_t< decltype( std::declval< T& >().reserve( std::declval< typename T::size_type >() ) ) > > = true;
 
    }  // namespace internal
 
+   // the values of a single column, as returned by result::column< T >()
+   template< typename T >
+   struct column_values
+   {
+      std::vector< T > values;            // NULL values are result_traits< T >::null() or value-initialized
+      std::vector< std::uint8_t > nulls;  // bit ( row % 8 ) of nulls[ row / 8 ] is set for a NULL value
+
+      [[nodiscard]] auto is_null( const std::size_t row ) const noexcept -> bool
+      {
+         return ( nulls[ row / 8 ] & ( 1U << ( row % 8 ) ) ) != 0;
+      }
+   };
+
    class result
    {
    private:
+      friend class async_result;
       friend class connection;
+      friend class cursor;
+      friend class pipeline;
+      friend class result_stream;
+      friend class row;
       friend class table_writer;
+      friend class transaction;
 
-      const std::shared_ptr< PGresult > m_pgresult;
+      const std::shared_ptr< internal::column_index > m_index;  // owns the PGresult or the snapshot
+      const std::shared_ptr< PGresult > m_pgresult;             // shares ownership with m_index, nullptr for snapshots
+      const internal::snapshot* const m_snapshot;               // owned by m_index, nullptr unless created by snapshot()
       const std::size_t m_columns;
       const std::size_t m_rows;
 
       void check_has_result_set() const;
       void check_row( const std::size_t row ) const;
+      void check_column( const std::size_t column ) const;
+
+      // the data of either representation, without any checks
+      [[nodiscard]] auto cmd_tuples() const noexcept -> const char*;
+
+      [[nodiscard]] auto value_is_null( const std::size_t row, const std::size_t column ) const noexcept -> bool
+      {
+         return ( m_snapshot != nullptr ) ? m_snapshot->is_null( row, column ) : ( PQgetisnull( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) ) != 0 );
+      }
+
+      [[nodiscard]] auto value( const std::size_t row, const std::size_t column ) const noexcept -> const char*
+      {
+         return ( m_snapshot != nullptr ) ? m_snapshot->get( row, column ) : PQgetvalue( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) );
+      }
+
+      [[nodiscard]] auto value_length( const std::size_t row, const std::size_t column ) const noexcept -> std::size_t
+      {
+         return ( m_snapshot != nullptr ) ? m_snapshot->length( row, column ) : static_cast< std::size_t >( PQgetlength( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) ) );
+      }
+
+      [[nodiscard]] auto column_is_binary( const std::size_t column ) const noexcept -> bool
+      {
+         return ( m_snapshot != nullptr ) ? m_snapshot->is_binary( column ) : ( PQfformat( m_pgresult.get(), static_cast< int >( column ) ) == 1 );
+      }
+
+      [[nodiscard]] auto column_type( const std::size_t column ) const noexcept -> Oid
+      {
+         return ( m_snapshot != nullptr ) ? m_snapshot->type( column ) : PQftype( m_pgresult.get(), static_cast< int >( column ) );
+      }
+
+      [[nodiscard]] auto binary_decoder_missing( const std::size_t column, const std::string& type ) const -> std::runtime_error;
+
+      // the format and the bounds are checked once, the loops only call the decoder for each value
+      template< typename T, typename F >
+      void decode_column( const std::size_t column, const F& store, std::uint8_t* nulls ) const
+      {
+         static_assert( result_traits_size< T > == 1, "result::column< T >() requires T to be a single-column type" );
+         check_column( column );
+         const auto store_null = [ & ]( const std::size_t row ) {
+            nulls[ row / 8 ] |= static_cast< std::uint8_t >( 1U << ( row % 8 ) );
+            if constexpr( result_traits_has_null< T > ) {
+               store( row, result_traits< T >::null() );
+            }
+         };
+         if( column_is_binary( column ) ) {
+            if constexpr( result_binary_traits_has_from< T > ) {
+               const Oid type = column_type( column );
+               for( std::size_t row = 0; row < m_rows; ++row ) {
+                  if( value_is_null( row, column ) ) {
+                     store_null( row );
+                  }
+                  else {
+                     store( row, result_binary_traits< T >::from( value( row, column ), value_length( row, column ), type ) );
+                  }
+               }
+            }
+            else {
+               throw binary_decoder_missing( column, internal::demangle< T >() );
+            }
+         }
+         else {
+            for( std::size_t row = 0; row < m_rows; ++row ) {
+               if( value_is_null( row, column ) ) {
+                  store_null( row );
+               }
+               else {
+                  if constexpr( result_traits_has_sized_from< T > ) {
+                     store( row, result_traits< T >::from( value( row, column ), value_length( row, column ) ) );
+                  }
+                  else {
+                     store( row, result_traits< T >::from( value( row, column ) ) );
+                  }
+               }
+            }
+         }
+      }
+
+      // converts rows to T, prepared once per result when result_traits< T > provides bind()
+      template< typename T >
+      [[nodiscard]] auto row_converter() const
+      {
+         if constexpr( result_traits_has_bind< T > ) {
+            return result_traits< T >::bind( *this );
+         }
+         else {
+            return []( const pq::row& row ) { return row.as< T >(); };
+         }
+      }
 
       enum class mode_t
       {
@@ -56,6 +182,7 @@ namespace tao::pq
          expect_copy_in
       };
       result( PGresult* pgresult, const mode_t mode = mode_t::expect_ok );
+      explicit result( std::unique_ptr< const internal::snapshot >&& snapshot );
 
    public:
       [[nodiscard]] auto has_rows_affected() const noexcept -> bool;
@@ -69,35 +196,198 @@ namespace tao::pq
       [[nodiscard]] auto name( const std::size_t column ) const -> std::string;
       [[nodiscard]] auto index( const std::string& in_name ) const -> std::size_t;
 
+      // whether the values of the column were received in binary format
+      [[nodiscard]] auto is_binary( const std::size_t column ) const -> bool;
+
       [[nodiscard]] auto empty() const -> bool;
       [[nodiscard]] auto size() const -> std::size_t;
 
-      class const_iterator
-         : private row
+      template< typename T >
+      class typed_range;
+
+      // a random access iterator over the rows, dereferencing yields the row itself for const_iterator,
+      // or the row converted to T for the iterators of as_range< T >(), in both cases by value
+      template< typename T >
+      class basic_iterator
       {
       private:
          friend class result;
 
-         const_iterator( const row& r ) noexcept
-            : row( r )
+         const result* m_result = nullptr;
+         const typed_range< T >* m_range = nullptr;  // converts the rows, unused for pq::row
+         std::size_t m_row = 0;
+
+         basic_iterator( const result* in_result, const typed_range< T >* in_range, const std::size_t in_row ) noexcept
+            : m_result( in_result ),
+              m_range( in_range ),
+              m_row( in_row )
          {}
 
       public:
-         [[nodiscard]] friend auto operator!=( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         // dereferencing yields a prvalue, which only satisfies the requirements of legacy input iterators,
+         // while the C++20 iterator concepts allow random access
+         using iterator_category = std::input_iterator_tag;
+         using iterator_concept = std::random_access_iterator_tag;
+         using value_type = T;
+         using difference_type = std::ptrdiff_t;
+         using pointer = void;
+         using reference = T;
+
+         basic_iterator() noexcept = default;
+
+         [[nodiscard]] auto operator*() const noexcept( std::is_same_v< T, pq::row > ) -> T
          {
-            return lhs.m_row != rhs.m_row;
+            if constexpr( std::is_same_v< T, pq::row > ) {
+               return ( *m_result )[ m_row ];
+            }
+            else {
+               return m_range->m_convert( ( *m_result )[ m_row ] );
+            }
+         }
+
+         [[nodiscard]] auto operator[]( const difference_type n ) const -> T
+         {
+            return *( *this + n );
          }
 
-         auto operator++() noexcept -> const_iterator&
+         auto operator++() noexcept -> basic_iterator&
          {
             ++m_row;
             return *this;
          }
 
-         [[nodiscard]] auto operator*() const noexcept -> const row&
+         auto operator++( int ) noexcept -> basic_iterator
+         {
+            basic_iterator nrv = *this;
+            ++m_row;
+            return nrv;
+         }
+
+         auto operator--() noexcept -> basic_iterator&
+         {
+            --m_row;
+            return *this;
+         }
+
+         auto operator--( int ) noexcept -> basic_iterator
+         {
+            basic_iterator nrv = *this;
+            --m_row;
+            return nrv;
+         }
+
+         auto operator+=( const difference_type n ) noexcept -> basic_iterator&
+         {
+            m_row += static_cast< std::size_t >( n );
+            return *this;
+         }
+
+         auto operator-=( const difference_type n ) noexcept -> basic_iterator&
          {
+            m_row -= static_cast< std::size_t >( n );
             return *this;
          }
+
+         [[nodiscard]] friend auto operator+( basic_iterator lhs, const difference_type n ) noexcept -> basic_iterator
+         {
+            return lhs += n;
+         }
+
+         [[nodiscard]] friend auto operator+( const difference_type n, basic_iterator rhs ) noexcept -> basic_iterator
+         {
+            return rhs += n;
+         }
+
+         [[nodiscard]] friend auto operator-( basic_iterator lhs, const difference_type n ) noexcept -> basic_iterator
+         {
+            return lhs -= n;
+         }
+
+         [[nodiscard]] friend auto operator-( const basic_iterator& lhs, const basic_iterator& rhs ) noexcept -> difference_type
+         {
+            return static_cast< difference_type >( lhs.m_row ) - static_cast< difference_type >( rhs.m_row );
+         }
+
+         [[nodiscard]] friend auto operator==( const basic_iterator& lhs, const basic_iterator& rhs ) noexcept
+         {
+            return lhs.m_row == rhs.m_row;
+         }
+
+         [[nodiscard]] friend auto operator!=( const basic_iterator& lhs, const basic_iterator& rhs ) noexcept
+         {
+            return lhs.m_row != rhs.m_row;
+         }
+
+         [[nodiscard]] friend auto operator<( const basic_iterator& lhs, const basic_iterator& rhs ) noexcept
+         {
+            return lhs.m_row < rhs.m_row;
+         }
+
+         [[nodiscard]] friend auto operator>( const basic_iterator& lhs, const basic_iterator& rhs ) noexcept
+         {
+            return lhs.m_row > rhs.m_row;
+         }
+
+         [[nodiscard]] friend auto operator<=( const basic_iterator& lhs, const basic_iterator& rhs ) noexcept
+         {
+            return lhs.m_row <= rhs.m_row;
+         }
+
+         [[nodiscard]] friend auto operator>=( const basic_iterator& lhs, const basic_iterator& rhs ) noexcept
+         {
+            return lhs.m_row >= rhs.m_row;
+         }
+      };
+
+      using const_iterator = basic_iterator< pq::row >;
+
+      // a view of the rows converted to T on access, e.g. for std::lower_bound() on a sorted result,
+      // the rows are converted like for vector< T >(), its iterators are only valid as long as the range exists
+      template< typename T >
+      class typed_range
+      {
+      private:
+         friend class result;
+         friend class basic_iterator< T >;
+
+         using converter_type = decltype( std::declval< const result& >().row_converter< T >() );
+
+         const result* m_result;
+         converter_type m_convert;
+
+         explicit typed_range( const result* in_result )
+            : m_result( in_result ),
+              m_convert( in_result->row_converter< T >() )
+         {}
+
+      public:
+         using iterator = basic_iterator< T >;
+         using const_iterator = basic_iterator< T >;
+
+         [[nodiscard]] auto begin() const noexcept -> iterator
+         {
+            return iterator( m_result, this, 0 );
+         }
+
+         [[nodiscard]] auto end() const noexcept -> iterator
+         {
+            return iterator( m_result, this, m_result->m_rows );
+         }
+
+         [[nodiscard]] auto empty() const noexcept -> bool
+         {
+            return m_result->m_rows == 0;
+         }
+
+         [[nodiscard]] auto size() const noexcept -> std::size_t
+         {
+            return m_result->m_rows;
+         }
+
+         [[nodiscard]] auto operator[]( const std::size_t row ) const -> T
+         {
+            return m_convert( ( *m_result )[ row ] );
+         }
       };
 
       [[nodiscard]] auto begin() const -> const_iterator;
@@ -106,6 +396,9 @@ namespace tao::pq
       [[nodiscard]] auto is_null( const std::size_t row, const std::size_t column ) const -> bool;
       [[nodiscard]] auto get( const std::size_t row, const std::size_t column ) const -> const char*;
 
+      // the size of the value in bytes, required for binary values which may contain zeros
+      [[nodiscard]] auto length( const std::size_t row, const std::size_t column ) const -> std::size_t;
+
       [[nodiscard]] auto operator[]( const std::size_t row ) const noexcept
       {
          return pq::row( *this, row, 0, m_columns );
@@ -119,7 +412,7 @@ namespace tao::pq
          if( size() != 1 ) {
             throw std::runtime_error( internal::printf( "invalid result size: %zu rows, expected 1 row", m_rows ) );
          }
-         return ( *this )[ 0 ].as< T >();
+         return row_converter< T >()( ( *this )[ 0 ] );
       }
 
       template< typename T >
@@ -151,18 +444,82 @@ namespace tao::pq
             nrv.reserve( size() );
          }
          check_has_result_set();
+         const auto convert = row_converter< typename T::value_type >();
          for( const auto& row : *this ) {
-            nrv.insert( nrv.end(), row.as< typename T::value_type >() );
+            nrv.insert( nrv.end(), convert( row ) );
          }
          return nrv;
       }
 
+      // decodes a whole column at once, see column_values for the layout of the null bitmap
+      template< typename T >
+      [[nodiscard]] auto column( const std::size_t column ) const -> column_values< T >
+      {
+         check_has_result_set();
+         column_values< T > nrv;
+         nrv.values.resize( m_rows );
+         nrv.nulls.resize( ( m_rows + 7 ) / 8 );
+         decode_column< T >(
+            column, [ & ]( const std::size_t row, T&& value ) { nrv.values[ row ] = std::move( value ); }, nrv.nulls.data() );
+         return nrv;
+      }
+
+      // like column< T >( column ), but writes into caller-provided storage of at least size() values and ( size() + 7 ) / 8 bitmap bytes
+      template< typename T >
+      void column( const std::size_t column, const tao::span< T > values, const tao::span< std::uint8_t > nulls ) const
+      {
+         check_has_result_set();
+         if( ( values.size() < m_rows ) || ( nulls.size() < ( m_rows + 7 ) / 8 ) ) {
+            throw std::length_error( internal::printf( "insufficient storage for %zu rows: %zu values, %zu bitmap bytes", m_rows, values.size(), nulls.size() ) );
+         }
+         std::fill( nulls.begin(), nulls.begin() + ( m_rows + 7 ) / 8, std::uint8_t( 0 ) );
+         decode_column< T >(
+            column, [ & ]( const std::size_t row, T&& value ) { values[ row ] = std::move( value ); }, nulls.data() );
+      }
+
+      // the rows are converted lazily, the range is only valid as long as the result exists
+      template< typename T >
+      [[nodiscard]] auto as_range() const -> typed_range< T >
+      {
+         check_has_result_set();
+         return typed_range< T >( this );
+      }
+
       template< typename... Ts >
       [[nodiscard]] auto vector() const
       {
          return as_container< std::vector< Ts... > >();
       }
 
+      // the minimum number of rows per thread for parallel_vector()
+      static constexpr std::size_t parallel_min_rows = 16384;
+
+      // like vector(), but partitions the rows across up to 'threads' threads (0 means one per hardware thread),
+      // smaller results use fewer threads or are converted sequentially, the first failed conversion is rethrown
+      template< typename... Ts >
+      [[nodiscard]] auto parallel_vector( std::size_t threads = 0 ) const
+      {
+         using T = typename std::vector< Ts... >::value_type;
+         static_assert( std::is_default_constructible_v< T >, "parallel_vector< T >() requires T to be default constructible" );
+         static_assert( !std::is_same_v< T, bool >, "parallel_vector< bool >() is not supported, use vector< bool >()" );
+         check_has_result_set();
+         if( threads == 0 ) {
+            threads = std::thread::hardware_concurrency();
+         }
+         threads = std::min( threads, m_rows / parallel_min_rows );
+         if( threads <= 1 ) {
+            return vector< Ts... >();
+         }
+         std::vector< Ts... > nrv( m_rows );
+         const auto convert = row_converter< T >();
+         internal::parallel_for( m_rows, threads, [ & ]( const std::size_t first, const std::size_t last ) {
+            for( std::size_t row = first; row < last; ++row ) {
+               nrv[ row ] = convert( ( *this )[ row ] );
+            }
+         } );
+         return nrv;
+      }
+
       template< typename... Ts >
       [[nodiscard]] auto list() const
       {
@@ -217,6 +574,23 @@ namespace tao::pq
          return as_container< std::unordered_multimap< Ts... > >();
       }
 
+      // a compact copy of the result in a single contiguous block, with the same interface
+      [[nodiscard]] auto snapshot() const -> result;
+
+      [[nodiscard]] auto is_snapshot() const noexcept -> bool
+      {
+         return m_snapshot != nullptr;
+      }
+
+      // the representation used by snapshot(), suitable for writing to a file
+      [[nodiscard]] auto serialize() const -> std::string;
+
+      // a snapshot from the output of serialize(), the data is not copied and must remain valid as long as owner is referenced,
+      // which allows to use a memory-mapped file that is unmapped by owner's deleter
+      [[nodiscard]] static auto deserialize( std::shared_ptr< const void > owner, const char* data, const std::size_t size ) -> result;
+      [[nodiscard]] static auto deserialize( std::string data ) -> result;
+
+      // nullptr for snapshots
       [[nodiscard]] auto underlying_raw_ptr() -> PGresult*
       {
          return m_pgresult.get();
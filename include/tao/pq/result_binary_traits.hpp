@@ -0,0 +1,232 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_RESULT_BINARY_TRAITS_HPP
+#define TAO_PQ_RESULT_BINARY_TRAITS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/decimal.hpp>
+#include <tao/pq/inet.hpp>
+#include <tao/pq/internal/chrono.hpp>
+#include <tao/pq/macaddr.hpp>
+#include <tao/pq/uuid.hpp>
+
+namespace tao::pq
+{
+   // decodes a value of a column which was received in binary format,
+   // the value is in network byte order as sent by the server's send function for the column's type,
+   // type is the oid of the column's type, or of the element type for array elements, and is checked by the decoders
+   template< typename T, typename = void >
+   struct result_binary_traits
+   {};
+
+   template< typename T, typename = void >
+   inline constexpr bool result_binary_traits_has_from = false;
+
+   template< typename T >
+   inline constexpr bool result_binary_traits_has_from< T, decltype( (void)result_binary_traits< T >::from( std::declval< const char* >(), std::declval< std::size_t >(), std::declval< Oid >() ) ) > = true;
+
+   template<>
+   struct result_binary_traits< const char* >
+   {
+      // libpq always appends a terminating zero
+      [[nodiscard]] static auto from( const char* value, const std::size_t /*unused*/, const Oid /*unused*/ ) noexcept -> const char*
+      {
+         return value;
+      }
+   };
+
+   template<>
+   struct result_binary_traits< std::string >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid /*unused*/ ) -> std::string
+      {
+         return std::string( value, size );
+      }
+   };
+
+   template<>
+   struct result_binary_traits< std::string_view >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid /*unused*/ ) noexcept -> std::string_view
+      {
+         return std::string_view( value, size );
+      }
+   };
+
+   template<>
+   struct result_binary_traits< bool >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> bool;
+   };
+
+   template<>
+   struct result_binary_traits< char >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> char;
+   };
+
+   template<>
+   struct result_binary_traits< signed char >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> signed char;
+   };
+
+   template<>
+   struct result_binary_traits< unsigned char >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> unsigned char;
+   };
+
+   template<>
+   struct result_binary_traits< short >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> short;
+   };
+
+   template<>
+   struct result_binary_traits< unsigned short >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> unsigned short;
+   };
+
+   template<>
+   struct result_binary_traits< int >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> int;
+   };
+
+   template<>
+   struct result_binary_traits< unsigned >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> unsigned;
+   };
+
+   template<>
+   struct result_binary_traits< long >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> long;
+   };
+
+   template<>
+   struct result_binary_traits< unsigned long >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> unsigned long;
+   };
+
+   template<>
+   struct result_binary_traits< long long >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> long long;
+   };
+
+   template<>
+   struct result_binary_traits< unsigned long long >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> unsigned long long;
+   };
+
+   template<>
+   struct result_binary_traits< float >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> float;
+   };
+
+   template<>
+   struct result_binary_traits< double >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> double;
+   };
+
+   template<>
+   struct result_binary_traits< long double >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> long double;
+   };
+
+   // accepts numeric values only
+   template<>
+   struct result_binary_traits< decimal >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> decimal;
+   };
+
+   // accepts uuid values only
+   template<>
+   struct result_binary_traits< uuid >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> uuid;
+   };
+
+   // accepts macaddr values only
+   template<>
+   struct result_binary_traits< macaddr >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> macaddr;
+   };
+
+   // accepts inet and cidr values
+   template<>
+   struct result_binary_traits< inet >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> inet;
+   };
+
+   // accepts cidr values, and inet values without bits to the right of the netmask
+   template<>
+   struct result_binary_traits< cidr >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> cidr;
+   };
+
+   // accepts date, timestamp and timestamptz values
+   template< typename Duration >
+   struct result_binary_traits< std::chrono::time_point< std::chrono::system_clock, Duration > >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> std::chrono::time_point< std::chrono::system_clock, Duration >
+      {
+         return internal::from_postgres_microseconds< Duration >( internal::decode_timestamp( value, size, type ) );
+      }
+   };
+
+   // accepts interval values without months and time values
+   template< typename Rep, typename Period >
+   struct result_binary_traits< std::chrono::duration< Rep, Period > >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> std::chrono::duration< Rep, Period >
+      {
+         return internal::from_microseconds< std::chrono::duration< Rep, Period > >( internal::decode_interval( value, size, type ) );
+      }
+   };
+
+#if defined( TAO_PQ_USE_CALENDAR )
+   template<>
+   struct result_binary_traits< std::chrono::year_month_day >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> std::chrono::year_month_day
+      {
+         return std::chrono::year_month_day( result_binary_traits< std::chrono::sys_days >::from( value, size, type ) );
+      }
+   };
+#endif
+
+   template< typename T >
+   struct result_binary_traits< std::optional< T >, std::enable_if_t< result_binary_traits_has_from< T > > >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid type ) -> std::optional< T >
+      {
+         return result_binary_traits< T >::from( value, size, type );
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
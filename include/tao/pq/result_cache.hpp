@@ -0,0 +1,182 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_RESULT_CACHE_HPP
+#define TAO_PQ_RESULT_CACHE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/internal/gen.hpp>
+#include <tao/pq/parameter_traits.hpp>
+#include <tao/pq/result.hpp>
+#include <tao/pq/result_format.hpp>
+
+namespace tao::pq
+{
+   // how long a cached result may be used, and the channels whose notifications invalidate it
+   struct cache_policy
+   {
+      std::chrono::steady_clock::duration ttl;
+      std::vector< std::string > channels;
+
+      template< typename Rep, typename Period >
+      cache_policy( const std::chrono::duration< Rep, Period > in_ttl, std::vector< std::string > in_channels = {} )  // NOLINT(google-explicit-constructor)
+         : ttl( std::chrono::duration_cast< std::chrono::steady_clock::duration >( in_ttl ) ),
+           channels( std::move( in_channels ) )
+      {}
+   };
+
+   // opt-in client-side cache for the results of a connection pool's statements, keyed by the statement and its parameters,
+   // bounded by a memory budget with the least recently used entries evicted first, the cache is thread-safe
+   class result_cache final
+   {
+   private:
+      struct entry
+      {
+         std::string key;
+         result value;
+         std::chrono::steady_clock::time_point expires;
+         std::vector< std::string > channels;
+         std::size_t size;
+      };
+
+      const std::shared_ptr< connection_pool > m_pool;
+      const std::size_t m_budget;
+
+      std::mutex m_mutex;
+      const std::shared_ptr< connection > m_listener;  // dedicated to LISTEN, only used while m_mutex is locked
+      std::set< std::string, std::less<> > m_channels;
+      std::list< entry > m_entries;  // most recently used first
+      std::unordered_map< std::string_view, std::list< entry >::iterator > m_index;
+      std::size_t m_size = 0;
+      std::uint64_t m_invalidations = 0;
+
+      template< template< typename... > class Traits, typename A >
+      auto to_traits( const A& a ) const
+      {
+         using T = Traits< std::decay_t< const A& > >;
+         if constexpr( std::is_constructible_v< T, const A& > ) {
+            return T( a );
+         }
+         else if constexpr( std::is_constructible_v< T, PGconn*, const A& > ) {
+            return T( m_listener->underlying_raw_ptr(), a );
+         }
+         else {
+            static_assert( std::is_void_v< T >, "no valid conversion from A to Traits" );
+         }
+      }
+
+      static void append_parameter( std::string& key, const Oid type, const char* value, const int length, const int format );
+
+      template< std::size_t... Os, std::size_t... Is, typename... Ts >
+      static void append_indexed( std::string& key,
+                                  std::index_sequence< Os... > /*unused*/,
+                                  std::index_sequence< Is... > /*unused*/,
+                                  const std::tuple< Ts... >& tuple )
+      {
+         ( append_parameter( key, std::get< Os >( tuple ).template type< Is >(), std::get< Os >( tuple ).template value< Is >(), std::get< Os >( tuple ).template length< Is >(), std::get< Os >( tuple ).template format< Is >() ), ... );
+      }
+
+      template< typename... Ts >
+      static void append_traits( std::string& key, const Ts&... ts )
+      {
+         using gen = internal::gen< Ts::columns... >;
+         append_indexed( key, typename gen::outer_sequence(), typename gen::inner_sequence(), std::tie( ts... ) );
+      }
+
+      // all of the following require m_mutex to be locked
+      void listen( const std::vector< std::string >& channels );
+      void handle_notifications_locked();
+      void invalidate_locked( const std::string_view channel );
+      void purge_expired_locked() noexcept;
+      void erase( const std::list< entry >::iterator it ) noexcept;
+      [[nodiscard]] auto find( const std::string& key ) -> std::optional< result >;
+      [[nodiscard]] auto insert( std::string&& key, const result& r, const cache_policy& policy, const std::uint64_t invalidations ) -> result;
+
+   public:
+      [[nodiscard]] static auto create( const std::shared_ptr< connection_pool >& pool, const std::size_t budget ) -> std::shared_ptr< result_cache >;
+
+   private:
+      // pass-key idiom
+      class private_key
+      {
+         private_key() = default;
+         friend auto result_cache::create( const std::shared_ptr< connection_pool >& pool, const std::size_t budget ) -> std::shared_ptr< result_cache >;
+      };
+
+   public:
+      result_cache( const private_key& /*unused*/, const std::shared_ptr< connection_pool >& pool, const std::size_t budget );
+      ~result_cache();
+
+      result_cache( const result_cache& ) = delete;
+      result_cache( result_cache&& ) = delete;
+      void operator=( const result_cache& ) = delete;
+      void operator=( result_cache&& ) = delete;
+
+      // returns a cached snapshot of the result if available, otherwise executes the statement through the pool,
+      // results of statements which fail are not cached
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto execute( const cache_policy& policy, const char* statement, As&&... as ) -> result
+      {
+         std::unique_lock lock( m_mutex );
+         std::string key( 1, static_cast< char >( Format ) );
+         key += statement;
+         key += '\0';
+         append_traits( key, to_traits< Traits >( as )... );
+         // listen before executing the statement, a notification sent in between must not be lost
+         listen( policy.channels );
+         if( auto nrv = find( key ) ) {
+            return std::move( *nrv );
+         }
+         const std::uint64_t invalidations = m_invalidations;
+         lock.unlock();
+         const auto r = m_pool->execute< Traits, Format >( statement, std::forward< As >( as )... );
+         lock.lock();
+         return insert( std::move( key ), r, policy, invalidations );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto execute( const cache_policy& policy, const std::string& statement, As&&... as ) -> result
+      {
+         return execute< Traits, Format >( policy, statement.c_str(), std::forward< As >( as )... );
+      }
+
+      // processes the notifications received so far without blocking, also called by execute() before each lookup
+      void handle_notifications();
+
+      // the socket of the dedicated connection, which becomes readable when notifications arrive
+      [[nodiscard]] auto socket() const -> int;
+
+      // removes all entries which depend on the channel
+      void invalidate( const std::string& channel );
+      void clear();
+
+      // the number of entries, expired entries are removed first
+      [[nodiscard]] auto size() -> std::size_t;
+
+      // the memory used by all unexpired entries in bytes, which is at most the budget
+      [[nodiscard]] auto memory() -> std::size_t;
+   };
+
+}  // namespace tao::pq
+
+#endif
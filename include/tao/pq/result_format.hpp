@@ -0,0 +1,23 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_RESULT_FORMAT_HPP
+#define TAO_PQ_RESULT_FORMAT_HPP
+
+namespace tao::pq
+{
+   // the format in which the server sends the values of a result set
+   enum class result_format
+   {
+      text = 0,
+      binary = 1
+   };
+
+   // the result format used when a statement is sent with the parameter traits Traits,
+   // specialize to change the default for your own traits
+   template< template< typename... > class Traits >
+   inline constexpr result_format default_result_format = result_format::text;
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,133 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_RESULT_STREAM_HPP
+#define TAO_PQ_RESULT_STREAM_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
+
+#include <tao/pq/result.hpp>
+#include <tao/pq/row.hpp>
+
+namespace tao::pq
+{
+   class connection;
+   class transaction;
+
+   // receives the rows of a result set one at a time (or one chunk at a time),
+   // only the current row (or chunk) is held in memory
+   class result_stream
+   {
+   private:
+      friend class transaction;
+
+      std::shared_ptr< transaction > m_transaction;
+      std::shared_ptr< connection > m_connection;
+      std::optional< result > m_result;
+      std::size_t m_row;
+      bool m_done;
+
+      result_stream( const std::shared_ptr< transaction >& transaction, const std::size_t rows_per_chunk );
+
+      void fetch();
+      void advance();
+
+      [[nodiscard]] auto at_end() const noexcept -> bool
+      {
+         return m_done && ( m_row >= m_result->m_rows );
+      }
+
+   public:
+      result_stream( const result_stream& ) = delete;
+      result_stream( result_stream&& ) = default;
+      ~result_stream();
+
+      void operator=( const result_stream& ) = delete;
+      void operator=( result_stream&& ) = delete;
+
+      // the column metadata is available before the first row was consumed
+      [[nodiscard]] auto columns() const noexcept -> std::size_t
+      {
+         return m_result->columns();
+      }
+
+      [[nodiscard]] auto name( const std::size_t column ) const -> std::string
+      {
+         return m_result->name( column );
+      }
+
+      [[nodiscard]] auto index( const std::string& in_name ) const -> std::size_t
+      {
+         return m_result->index( in_name );
+      }
+
+      // a single pass input iterator, a row is only valid until the iterator is incremented
+      class const_iterator
+      {
+      private:
+         friend class result_stream;
+
+         result_stream* m_stream;
+
+         explicit const_iterator( result_stream* stream ) noexcept
+            : m_stream( stream )
+         {}
+
+      public:
+         using iterator_category = std::input_iterator_tag;
+         using value_type = row;
+         using difference_type = std::ptrdiff_t;
+         using pointer = void;
+         using reference = row;
+
+         [[nodiscard]] friend auto operator==( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         {
+            return lhs.m_stream == rhs.m_stream;
+         }
+
+         [[nodiscard]] friend auto operator!=( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         {
+            return lhs.m_stream != rhs.m_stream;
+         }
+
+         auto operator++() -> const_iterator&
+         {
+            m_stream->advance();
+            if( m_stream->at_end() ) {
+               m_stream = nullptr;
+            }
+            return *this;
+         }
+
+         [[nodiscard]] auto operator*() const noexcept -> row
+         {
+            return ( *m_stream->m_result )[ m_stream->m_row ];
+         }
+      };
+
+      [[nodiscard]] auto begin() -> const_iterator
+      {
+         return const_iterator( at_end() ? nullptr : this );
+      }
+
+      [[nodiscard]] auto end() noexcept -> const_iterator
+      {
+         return const_iterator( nullptr );
+      }
+
+      // calls f( row ) for each remaining row
+      template< typename F >
+      void for_each( F&& f )
+      {
+         for( const auto& row : *this ) {
+            f( row );
+         }
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
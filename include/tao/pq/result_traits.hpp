@@ -4,13 +4,23 @@
 #ifndef TAO_PQ_RESULT_TRAITS_HPP
 #define TAO_PQ_RESULT_TRAITS_HPP
 
+#include <chrono>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include <tao/pq/decimal.hpp>
+#include <tao/pq/inet.hpp>
+#include <tao/pq/internal/chrono.hpp>
+#include <tao/pq/macaddr.hpp>
+#include <tao/pq/uuid.hpp>
+
 namespace tao::pq
 {
+   class result;
    class row;
 
    template< typename T, typename = void >
@@ -32,6 +42,21 @@ namespace tao::pq
    template< typename T >
    inline constexpr bool result_traits_has_null< T, decltype( (void)result_traits< T >::null() ) > = true;
 
+   // specializations may additionally provide from( const char*, std::size_t ) which then receives the length of the value
+   template< typename T, typename = void >
+   inline constexpr bool result_traits_has_sized_from = false;
+
+   template< typename T >
+   inline constexpr bool result_traits_has_sized_from< T, decltype( (void)result_traits< T >::from( std::declval< const char* >(), std::declval< std::size_t >() ) ) > = true;
+
+   // specializations may additionally provide bind( const result& ) which returns a function object converting rows of
+   // that result, e.g. to resolve column names once per result instead of once per row
+   template< typename T, typename = void >
+   inline constexpr bool result_traits_has_bind = false;
+
+   template< typename T >
+   inline constexpr bool result_traits_has_bind< T, decltype( (void)result_traits< T >::bind( std::declval< const result& >() ) ) > = true;
+
    template<>
    struct result_traits< const char* >
    {
@@ -48,6 +73,26 @@ namespace tao::pq
       {
          return value;
       }
+
+      [[nodiscard]] static auto from( const char* value, const std::size_t size ) -> std::string
+      {
+         return std::string( value, size );
+      }
+   };
+
+   // the view is valid for the lifetime of (any copy of) the result
+   template<>
+   struct result_traits< std::string_view >
+   {
+      [[nodiscard]] static auto from( const char* value ) noexcept -> std::string_view
+      {
+         return value;
+      }
+
+      [[nodiscard]] static auto from( const char* value, const std::size_t size ) noexcept -> std::string_view
+      {
+         return std::string_view( value, size );
+      }
    };
 
    template<>
@@ -140,6 +185,87 @@ namespace tao::pq
       [[nodiscard]] static auto from( const char* value ) -> long double;
    };
 
+   // accepts dates and timestamps, with or without time zone, in the ISO format
+   template< typename Duration >
+   struct result_traits< std::chrono::time_point< std::chrono::system_clock, Duration > >
+   {
+      [[nodiscard]] static auto from( const char* value ) -> std::chrono::time_point< std::chrono::system_clock, Duration >
+      {
+         return internal::from_postgres_microseconds< Duration >( internal::parse_timestamp( value ) );
+      }
+   };
+
+   // accepts intervals without years and months, and times
+   template< typename Rep, typename Period >
+   struct result_traits< std::chrono::duration< Rep, Period > >
+   {
+      [[nodiscard]] static auto from( const char* value ) -> std::chrono::duration< Rep, Period >
+      {
+         return internal::from_microseconds< std::chrono::duration< Rep, Period > >( internal::parse_interval( value ) );
+      }
+   };
+
+#if defined( TAO_PQ_USE_CALENDAR )
+   template<>
+   struct result_traits< std::chrono::year_month_day >
+   {
+      [[nodiscard]] static auto from( const char* value ) -> std::chrono::year_month_day
+      {
+         return std::chrono::year_month_day( result_traits< std::chrono::sys_days >::from( value ) );
+      }
+   };
+#endif
+
+   template<>
+   struct result_traits< decimal >
+   {
+      [[nodiscard]] static auto from( const char* value ) -> decimal
+      {
+         return decimal::from_string( value );
+      }
+
+      [[nodiscard]] static auto from( const char* value, const std::size_t size ) -> decimal
+      {
+         return decimal::from_string( std::string_view( value, size ) );
+      }
+   };
+
+   template<>
+   struct result_traits< uuid >
+   {
+      [[nodiscard]] static auto from( const char* value ) -> uuid
+      {
+         return uuid::from_string( value );
+      }
+   };
+
+   template<>
+   struct result_traits< macaddr >
+   {
+      [[nodiscard]] static auto from( const char* value ) -> macaddr
+      {
+         return macaddr::from_string( value );
+      }
+   };
+
+   template<>
+   struct result_traits< inet >
+   {
+      [[nodiscard]] static auto from( const char* value ) -> inet
+      {
+         return inet::from_string( value );
+      }
+   };
+
+   template<>
+   struct result_traits< cidr >
+   {
+      [[nodiscard]] static auto from( const char* value ) -> cidr
+      {
+         return cidr::from_string( value );
+      }
+   };
+
 }  // namespace tao::pq
 
 #endif
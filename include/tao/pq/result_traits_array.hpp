@@ -0,0 +1,153 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_RESULT_TRAITS_ARRAY_HPP
+#define TAO_PQ_RESULT_TRAITS_ARRAY_HPP
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <tao/pq/internal/array.hpp>
+#include <tao/pq/internal/demangle.hpp>
+#include <tao/pq/internal/printf.hpp>
+#include <tao/pq/result_binary_traits.hpp>
+#include <tao/pq/result_traits.hpp>
+#include <tao/pq/result_traits_optional.hpp>
+
+namespace tao::pq
+{
+   namespace internal
+   {
+      // vectors of bytes are reserved for bytea, just like for parameters
+      template< typename >
+      inline constexpr bool is_array_result = false;
+
+      template< typename T, typename A >
+      inline constexpr bool is_array_result< std::vector< T, A > > = !is_bytea_parameter< T >::value;
+
+      template< typename T >
+      inline constexpr bool is_string_view_result = std::is_same_v< T, std::string_view > || std::is_same_v< T, std::optional< std::string_view > >;
+
+      template< typename T >
+      [[nodiscard]] auto array_null() -> T
+      {
+         if constexpr( result_traits_has_null< T > ) {
+            return result_traits< T >::null();
+         }
+         else {
+            throw std::runtime_error( internal::printf( "unexpected NULL element in array for %s, use std::optional", internal::demangle< T >().c_str() ) );
+         }
+      }
+
+      template< typename V >
+      [[nodiscard]] auto parse_array( array_text_parser& parser, std::string& scratch ) -> V
+      {
+         using T = typename V::value_type;
+         V nrv;
+         nrv.reserve( parser.count() );
+         if( parser.open() ) {
+            do {
+               if constexpr( is_array_result< T > ) {
+                  nrv.push_back( parse_array< T >( parser, scratch ) );
+               }
+               else {
+                  const array_element e = parser.element( scratch );
+                  if( e.data == nullptr ) {
+                     nrv.push_back( array_null< T >() );
+                  }
+                  else {
+                     // zero-terminated for the traits, the scratch buffer's capacity is reused for all elements
+                     if( !e.copied ) {
+                        scratch.assign( e.data, e.size );
+                     }
+                     if constexpr( result_traits_has_sized_from< T > ) {
+                        nrv.push_back( result_traits< T >::from( scratch.c_str(), scratch.size() ) );
+                     }
+                     else {
+                        nrv.push_back( result_traits< T >::from( scratch.c_str() ) );
+                     }
+                  }
+               }
+            } while( parser.next() );
+         }
+         return nrv;
+      }
+
+      template< typename V >
+      [[nodiscard]] auto decode_array( array_binary_reader& reader, const std::size_t dimension ) -> V
+      {
+         using T = typename V::value_type;
+         V nrv;
+         const std::size_t size = reader.size( dimension );
+         nrv.reserve( size );
+         for( std::size_t i = 0; i < size; ++i ) {
+            if constexpr( is_array_result< T > ) {
+               nrv.push_back( decode_array< T >( reader, dimension + 1 ) );
+            }
+            else {
+               const array_element e = reader.element();
+               if( e.data == nullptr ) {
+                  nrv.push_back( array_null< T >() );
+               }
+               else {
+                  nrv.push_back( result_binary_traits< T >::from( e.data, e.size, reader.element_type() ) );
+               }
+            }
+         }
+         return nrv;
+      }
+
+   }  // namespace internal
+
+   // decodes arrays, nested vectors decode multidimensional arrays, NULL elements require std::optional
+   template< typename T, typename A >
+   struct result_traits< std::vector< T, A >, std::enable_if_t< internal::is_array_result< std::vector< T, A > > > >
+   {
+      [[nodiscard]] static auto from( const char* value, const std::size_t size ) -> std::vector< T, A >
+      {
+         // escaped elements would have to be copied, so views are only possible independent of the values in binary format
+         if constexpr( internal::is_string_view_result< typename internal::array_traits< std::vector< T, A > >::element_type > ) {
+            throw std::runtime_error( "array elements of type std::string_view require the binary format, use std::string for the text format" );
+         }
+         else {
+            internal::array_text_parser parser( value, size );
+            std::string scratch;
+            auto nrv = internal::parse_array< std::vector< T, A > >( parser, scratch );
+            parser.finish();
+            return nrv;
+         }
+      }
+
+      [[nodiscard]] static auto from( const char* value ) -> std::vector< T, A >
+      {
+         return from( value, std::char_traits< char >::length( value ) );
+      }
+   };
+
+   template< typename T, typename A >
+   struct result_binary_traits< std::vector< T, A >, std::enable_if_t< internal::is_array_result< std::vector< T, A > > && result_binary_traits_has_from< typename internal::array_traits< std::vector< T, A > >::element_type > > >
+   {
+      // the array's own type is not checked, the element type from the array's header is checked by the element decoder
+      [[nodiscard]] static auto from( const char* value, const std::size_t size, const Oid /*unused*/ ) -> std::vector< T, A >
+      {
+         internal::array_binary_reader reader( value, size );
+         if( reader.dimensions() == 0 ) {
+            return {};
+         }
+         if( reader.dimensions() != internal::array_traits< std::vector< T, A > >::dimensions ) {
+            throw std::runtime_error( internal::printf( "array with %zu dimensions can not be decoded as %s", reader.dimensions(), internal::demangle< std::vector< T, A > >().c_str() ) );
+         }
+         auto nrv = internal::decode_array< std::vector< T, A > >( reader, 0 );
+         reader.finish();
+         return nrv;
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
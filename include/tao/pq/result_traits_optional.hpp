@@ -4,7 +4,9 @@
 #ifndef TAO_PQ_RESULT_TRAITS_OPTIONAL_HPP
 #define TAO_PQ_RESULT_TRAITS_OPTIONAL_HPP
 
+#include <cstddef>
 #include <optional>
+#include <type_traits>
 
 #include <tao/pq/result_traits.hpp>
 #include <tao/pq/row.hpp>
@@ -26,6 +28,12 @@ namespace tao::pq
          return result_traits< T >::from( value );
       }
 
+      template< typename U = T >
+      [[nodiscard]] static auto from( const char* value, const std::size_t size ) -> std::enable_if_t< result_traits_has_sized_from< U >, std::optional< T > >
+      {
+         return result_traits< T >::from( value, size );
+      }
+
       [[nodiscard]] static auto from( const row& row ) -> std::optional< T >
       {
          for( std::size_t column = 0; column < row.columns(); ++column ) {
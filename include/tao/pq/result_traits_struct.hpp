@@ -0,0 +1,103 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_RESULT_TRAITS_STRUCT_HPP
+#define TAO_PQ_RESULT_TRAITS_STRUCT_HPP
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <tao/pq/result.hpp>
+#include <tao/pq/result_traits.hpp>
+#include <tao/pq/row.hpp>
+
+namespace tao::pq
+{
+   template< typename C, typename M >
+   struct member_binding
+   {
+      const char* name;
+      M C::*pointer;
+   };
+
+   // binds the member to the column with the given name, the name is matched just like for row::index()
+   template< typename C, typename M >
+   [[nodiscard]] constexpr auto member( const char* name, M C::*pointer ) noexcept -> member_binding< C, M >
+   {
+      return { name, pointer };
+   }
+
+   // specialize with a static constexpr tuple of member bindings to map a struct, e.g.
+   // template<> struct tao::pq::result_members< user > { static constexpr auto members = std::make_tuple( tao::pq::member( "id", &user::id ), ... ); };
+   template< typename T >
+   struct result_members;
+
+   template< typename T, typename = void >
+   inline constexpr bool result_has_members = false;
+
+   template< typename T >
+   inline constexpr bool result_has_members< T, decltype( (void)result_members< T >::members ) > = true;
+
+   template< typename T >
+   struct result_traits< T, std::enable_if_t< result_has_members< T > > >
+   {
+   private:
+      static constexpr std::size_t count = std::tuple_size_v< std::decay_t< decltype( result_members< T >::members ) > >;
+
+      template< std::size_t... Is >
+      [[nodiscard]] static constexpr auto columns( std::index_sequence< Is... > /*unused*/ ) noexcept -> std::size_t
+      {
+         return ( 0 + ... + result_traits_size< std::decay_t< decltype( std::declval< T& >().*std::get< Is >( result_members< T >::members ).pointer ) > > );
+      }
+
+      template< std::size_t... Is >
+      [[nodiscard]] static constexpr auto names( std::index_sequence< Is... > /*unused*/ ) noexcept -> std::array< const char*, count >
+      {
+         return { std::get< Is >( result_members< T >::members ).name... };
+      }
+
+      [[nodiscard]] static auto name( const std::size_t i ) noexcept -> const char*
+      {
+         return names( std::make_index_sequence< count >() )[ i ];
+      }
+
+      template< typename F, std::size_t... Is >
+      [[nodiscard]] static auto convert( const row& row, const F& column, std::index_sequence< Is... > /*unused*/ ) -> T
+      {
+         T nrv{};
+         ( ( nrv.*std::get< Is >( result_members< T >::members ).pointer = row.get< std::decay_t< decltype( nrv.*std::get< Is >( result_members< T >::members ).pointer ) > >( column( Is ) ) ), ... );
+         return nrv;
+      }
+
+   public:
+      static_assert( std::is_default_constructible_v< T >, "mapped struct T must be default constructible" );
+
+      static constexpr std::size_t size = columns( std::make_index_sequence< count >() );
+
+      // resolves the column names for every row
+      [[nodiscard]] static auto from( const row& row ) -> T
+      {
+         return convert(
+            row, [ & ]( const std::size_t i ) { return row.index( name( i ) ); }, std::make_index_sequence< count >() );
+      }
+
+      // resolves the column names once, the rows may contain additional columns
+      [[nodiscard]] static auto bind( const result& in_result )
+      {
+         std::array< std::size_t, count > indices{};
+         for( std::size_t i = 0; i < count; ++i ) {
+            indices[ i ] = in_result.index( name( i ) );
+         }
+         return [ indices ]( const row& row ) {
+            return convert(
+               row, [ & ]( const std::size_t i ) { return indices[ i ]; }, std::make_index_sequence< count >() );
+         };
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
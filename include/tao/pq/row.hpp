@@ -13,6 +13,7 @@
 #include <tao/pq/field.hpp>
 #include <tao/pq/internal/demangle.hpp>
 #include <tao/pq/internal/printf.hpp>
+#include <tao/pq/result_binary_traits.hpp>
 #include <tao/pq/result_traits.hpp>
 
 namespace tao::pq
@@ -36,8 +37,40 @@ namespace tao::pq
            m_columns( in_columns )
       {}
 
+      // checks the row as well, as rows from the unchecked result::operator[] may be out of range
       void ensure_column( const std::size_t column ) const;
 
+      // the row and the column were checked with ensure_column(),
+      // the typed accessors below use these to avoid repeating the result's checks for every field
+      [[nodiscard]] auto is_null_unchecked( const std::size_t column ) const noexcept -> bool;
+      [[nodiscard]] auto get_unchecked( const std::size_t column ) const noexcept -> const char*;
+      [[nodiscard]] auto is_binary_unchecked( const std::size_t column ) const noexcept -> bool;
+      [[nodiscard]] auto length_unchecked( const std::size_t column ) const noexcept -> std::size_t;
+      [[nodiscard]] auto type_unchecked( const std::size_t column ) const noexcept -> Oid;
+
+      [[nodiscard]] auto unexpected_null( const std::size_t column ) const -> std::runtime_error;
+      [[nodiscard]] auto binary_decoder_missing( const std::size_t column, const std::string& type ) const -> std::runtime_error;
+
+      // decodes a non-NULL value, binary values require a matching result_binary_traits specialization
+      template< typename T >
+      [[nodiscard]] auto from( const std::size_t column ) const -> T
+      {
+         if( is_binary_unchecked( column ) ) {
+            if constexpr( result_binary_traits_has_from< T > ) {
+               return result_binary_traits< T >::from( get_unchecked( column ), length_unchecked( column ), type_unchecked( column ) );
+            }
+            else {
+               throw binary_decoder_missing( column, internal::demangle< T >() );
+            }
+         }
+         if constexpr( result_traits_has_sized_from< T > ) {
+            return result_traits< T >::from( get_unchecked( column ), length_unchecked( column ) );
+         }
+         else {
+            return result_traits< T >::from( get_unchecked( column ) );
+         }
+      }
+
    public:
       [[nodiscard]] auto slice( const std::size_t offset, const std::size_t in_columns ) const -> row;
 
@@ -52,6 +85,9 @@ namespace tao::pq
       [[nodiscard]] auto is_null( const std::size_t column ) const -> bool;
       [[nodiscard]] auto get( const std::size_t column ) const -> const char*;
 
+      [[nodiscard]] auto is_binary( const std::size_t column ) const -> bool;
+      [[nodiscard]] auto length( const std::size_t column ) const -> std::size_t;
+
       template< typename T >
       [[nodiscard]] auto get( const std::size_t /*unused*/ ) const noexcept
          -> std::enable_if_t< result_traits_size< T > == 0, T >
@@ -68,10 +104,11 @@ namespace tao::pq
       [[nodiscard]] auto get( const std::size_t column ) const
          -> std::enable_if_t< result_traits_size< T > == 1 && result_traits_has_null< T >, T >
       {
-         if( is_null( column ) ) {
+         ensure_column( column );
+         if( is_null_unchecked( column ) ) {
             return result_traits< T >::null();
          }
-         return result_traits< T >::from( get( column ) );
+         return from< T >( column );
       }
 
       template< typename T >
@@ -79,7 +116,10 @@ namespace tao::pq
          -> std::enable_if_t< result_traits_size< T > == 1 && !result_traits_has_null< T >, T >
       {
          ensure_column( column );
-         return result_traits< T >::from( get( column ) );
+         if( is_null_unchecked( column ) ) {
+            throw unexpected_null( column );
+         }
+         return from< T >( column );
       }
 
       template< typename T >
@@ -98,10 +138,16 @@ namespace tao::pq
       template< typename T >
       [[nodiscard]] auto as() const -> T
       {
-         if( result_traits_size< T > != m_columns ) {
-            throw std::runtime_error( internal::printf( "datatype (%s) requires %zu columns, but row/slice has %zu columns", internal::demangle< T >().c_str(), result_traits_size< T >, m_columns ) );
+         if constexpr( result_traits_has_bind< T > ) {
+            // the traits select the columns themselves, e.g. by name, just like for result::vector< T >()
+            return result_traits< T >::from( *this );
+         }
+         else {
+            if( result_traits_size< T > != m_columns ) {
+               throw std::runtime_error( internal::printf( "datatype (%s) requires %zu columns, but row/slice has %zu columns", internal::demangle< T >().c_str(), result_traits_size< T >, m_columns ) );
+            }
+            return get< T >( 0 );
          }
-         return get< T >( 0 );
       }
 
       template< typename T >
@@ -125,7 +171,7 @@ namespace tao::pq
       [[nodiscard]] auto operator[]( const std::size_t column ) const -> field
       {
          ensure_column( column );
-         return field( *this, m_offset + column );
+         return field( *this, column );
       }
 
       [[nodiscard]] auto operator[]( const std::string& in_name ) const -> field
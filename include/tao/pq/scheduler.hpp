@@ -0,0 +1,35 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_SCHEDULER_HPP
+#define TAO_PQ_SCHEDULER_HPP
+
+#include <functional>
+
+#include <tao/pq/poll.hpp>
+
+namespace tao::pq
+{
+   // connects asynchronous operations to an event loop, e.g. an existing epoll() reactor
+   class scheduler
+   {
+   public:
+      scheduler() = default;
+      virtual ~scheduler() = default;
+
+      scheduler( const scheduler& ) = delete;
+      scheduler( scheduler&& ) = delete;
+      void operator=( const scheduler& ) = delete;
+      void operator=( scheduler&& ) = delete;
+
+      // invoke the callback once, as soon as the socket is ready as requested
+      virtual void wait( const int socket, const poll_status status, std::function< void() > callback ) = 0;
+
+      // the scheduler used by awaitables on the current thread, nullptr if there is none
+      [[nodiscard]] static auto current() noexcept -> scheduler*;
+      static void set_current( scheduler* s ) noexcept;
+   };
+
+}  // namespace tao::pq
+
+#endif
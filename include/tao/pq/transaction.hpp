@@ -4,19 +4,26 @@
 #ifndef TAO_PQ_TRANSACTION_HPP
 #define TAO_PQ_TRANSACTION_HPP
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include <tao/pq/async_result.hpp>
+#include <tao/pq/cursor.hpp>
 #include <tao/pq/internal/gen.hpp>
 #include <tao/pq/parameter_traits.hpp>
+#include <tao/pq/prepared_statement.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/result_format.hpp>
+#include <tao/pq/result_stream.hpp>
 
 namespace tao::pq
 {
    class connection;
+   class pipeline;
    class table_writer;
 
    class transaction
@@ -31,6 +38,8 @@ namespace tao::pq
          read_committed,
          read_uncommitted
       };
+      friend class async_result;
+      friend class result_stream;
       friend class table_writer;
 
    protected:
@@ -44,39 +53,54 @@ namespace tao::pq
       virtual void v_commit() = 0;
       virtual void v_rollback() = 0;
 
+      // the statements sent by async_commit() and async_rollback(), empty if v_commit() or v_rollback() do not block
+      [[nodiscard]] virtual auto v_commit_statement() const -> std::string;
+      [[nodiscard]] virtual auto v_rollback_statement() const -> std::string;
+
       virtual void v_reset() noexcept = 0;
 
       [[nodiscard]] auto current_transaction() const noexcept -> transaction*&;
       void check_current_transaction() const;
 
    private:
-      [[nodiscard]] auto execute_params( const char* statement,
-                                         const int n_params,
-                                         const Oid types[],
-                                         const char* const values[],
-                                         const int lengths[],
-                                         const int formats[] ) -> result;
-
-      template< std::size_t... Os, std::size_t... Is, typename... Ts >
-      [[nodiscard]] auto execute_indexed( const char* statement,
-                                          std::index_sequence< Os... > /*unused*/,
-                                          std::index_sequence< Is... > /*unused*/,
-                                          const std::tuple< Ts... >& tuple )
+      void send_params( const char* statement,
+                        const int n_params,
+                        const Oid types[],
+                        const char* const values[],
+                        const int lengths[],
+                        const int formats[],
+                        const result_format format );
+
+      void send_params( const prepared_statement& statement,
+                        const int n_params,
+                        const Oid types[],
+                        const char* const values[],
+                        const int lengths[],
+                        const int formats[],
+                        const result_format format );
+
+      template< result_format Format, typename S, std::size_t... Os, std::size_t... Is, typename... Ts >
+      void send_indexed( const S& statement,
+                         std::index_sequence< Os... > /*unused*/,
+                         std::index_sequence< Is... > /*unused*/,
+                         const std::tuple< Ts... >& tuple )
       {
          const Oid types[] = { std::get< Os >( tuple ).template type< Is >()... };
          const char* const values[] = { std::get< Os >( tuple ).template value< Is >()... };
          const int lengths[] = { std::get< Os >( tuple ).template length< Is >()... };
          const int formats[] = { std::get< Os >( tuple ).template format< Is >()... };
-         return execute_params( statement, sizeof...( Os ), types, values, lengths, formats );
+         send_params( statement, sizeof...( Os ), types, values, lengths, formats, Format );
       }
 
-      template< typename... Ts >
-      [[nodiscard]] auto execute_traits( const char* statement, const Ts&... ts )
+      template< result_format Format, typename S, typename... Ts >
+      void send_traits( const S& statement, const Ts&... ts )
       {
          using gen = internal::gen< Ts::columns... >;
-         return execute_indexed( statement, typename gen::outer_sequence(), typename gen::inner_sequence(), std::tie( ts... ) );
+         send_indexed< Format >( statement, typename gen::outer_sequence(), typename gen::inner_sequence(), std::tie( ts... ) );
       }
 
+      [[nodiscard]] auto async_end( const std::string& statement, void ( transaction::*end )() ) -> async_result;
+
       [[nodiscard]] auto underlying_raw_ptr() const noexcept -> PGconn*;
 
       template< template< typename... > class Traits, typename A >
@@ -103,25 +127,137 @@ namespace tao::pq
       void commit();
       void rollback();
 
+      // like commit() and rollback(), but without blocking
+      [[nodiscard]] auto async_commit() -> async_result;
+      [[nodiscard]] auto async_rollback() -> async_result;
+
       [[nodiscard]] auto subtransaction() -> std::shared_ptr< transaction >;
 
-      template< template< typename... > class Traits = parameter_text_traits, typename... As >
-      auto execute( const char* statement, As&&... as )
+      [[nodiscard]] auto pipeline() -> std::shared_ptr< pq::pipeline >;
+
+      // send a statement without waiting for its result
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      void send( const char* statement, As&&... as )
       {
-         return execute_traits( statement, to_traits< Traits >( std::forward< As >( as ) )... );
+         send_traits< Format >( statement, to_traits< Traits >( std::forward< As >( as ) )... );
       }
 
       // short-cut for no-arguments invocations
-      template< template< typename... > class Traits = parameter_text_traits >
-      auto execute( const char* statement )
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits > >
+      void send( const char* statement )
       {
-         return execute_params( statement, 0, nullptr, nullptr, nullptr, nullptr );
+         send_params( statement, 0, nullptr, nullptr, nullptr, nullptr, Format );
       }
 
-      template< template< typename... > class Traits = parameter_text_traits, typename... As >
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      void send( const std::string& statement, As&&... as )
+      {
+         send< Traits, Format >( statement.c_str(), std::forward< As >( as )... );
+      }
+
+      // send a statement returned by connection::prepare(), without looking up its name
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      void send( const prepared_statement& statement, As&&... as )
+      {
+         send_traits< Format >( statement, to_traits< Traits >( std::forward< As >( as ) )... );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits > >
+      void send( const prepared_statement& statement )
+      {
+         send_params( statement, 0, nullptr, nullptr, nullptr, nullptr, Format );
+      }
+
+      // wait for the result of the oldest statement sent
+      [[nodiscard]] auto get_result() -> result;
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      auto execute( const char* statement, As&&... as )
+      {
+         send< Traits, Format >( statement, std::forward< As >( as )... );
+         return get_result();
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
       auto execute( const std::string& statement, As&&... as )
       {
-         return execute< Traits >( statement.c_str(), std::forward< As >( as )... );
+         return execute< Traits, Format >( statement.c_str(), std::forward< As >( as )... );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      auto execute( const prepared_statement& statement, As&&... as )
+      {
+         send< Traits, Format >( statement, std::forward< As >( as )... );
+         return get_result();
+      }
+
+      // send a statement without blocking, the returned handle is driven by the connection's socket
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto async_execute( const char* statement, As&&... as )
+      {
+         async_result nrv( shared_from_this() );
+         send< Traits, Format >( statement, std::forward< As >( as )... );
+         return nrv;
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto async_execute( const std::string& statement, As&&... as )
+      {
+         return async_execute< Traits, Format >( statement.c_str(), std::forward< As >( as )... );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto async_execute( const prepared_statement& statement, As&&... as )
+      {
+         async_result nrv( shared_from_this() );
+         send< Traits, Format >( statement, std::forward< As >( as )... );
+         return nrv;
+      }
+
+      // receive the rows one at a time instead of all at once, the transaction is busy until the stream was consumed or destroyed
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto stream( const char* statement, As&&... as )
+      {
+         send< Traits, Format >( statement, std::forward< As >( as )... );
+         return result_stream( shared_from_this(), 1 );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto stream( const std::string& statement, As&&... as )
+      {
+         return stream< Traits, Format >( statement.c_str(), std::forward< As >( as )... );
+      }
+
+      // iterate over the result set through a server-side cursor, fetch_size rows at a time,
+      // the transaction is busy with prefetching until the cursor was consumed or closed
+      template< template< typename... > class Traits = parameter_text_traits, typename... As >
+      [[nodiscard]] auto cursor( const std::size_t fetch_size, const char* statement, As&&... as ) -> std::shared_ptr< pq::cursor >
+      {
+         const auto nrv = std::make_shared< pq::cursor >( pq::cursor::private_key(), shared_from_this(), fetch_size );
+         // in autocommit mode, the cursor would be closed right away without WITH HOLD
+         execute< Traits >( nrv->declare( statement, v_is_direct() ), std::forward< As >( as )... );
+         nrv->start();
+         return nrv;
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, typename... As >
+      [[nodiscard]] auto cursor( const std::size_t fetch_size, const std::string& statement, As&&... as ) -> std::shared_ptr< pq::cursor >
+      {
+         return cursor< Traits >( fetch_size, statement.c_str(), std::forward< As >( as )... );
+      }
+
+      // like stream(), but receives up to rows_per_chunk rows at a time when supported by libpq
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto stream( const std::size_t rows_per_chunk, const char* statement, As&&... as )
+      {
+         send< Traits, Format >( statement, std::forward< As >( as )... );
+         return result_stream( shared_from_this(), rows_per_chunk );
+      }
+
+      template< template< typename... > class Traits = parameter_text_traits, result_format Format = default_result_format< Traits >, typename... As >
+      [[nodiscard]] auto stream( const std::size_t rows_per_chunk, const std::string& statement, As&&... as )
+      {
+         return stream< Traits, Format >( rows_per_chunk, statement.c_str(), std::forward< As >( as )... );
       }
    };
 
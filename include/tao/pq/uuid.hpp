@@ -0,0 +1,59 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#ifndef TAO_PQ_UUID_HPP
+#define TAO_PQ_UUID_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace tao::pq
+{
+   // the 16 bytes of a uuid column in network byte order, i.e. in the order they are written
+   struct uuid
+   {
+      std::array< unsigned char, 16 > bytes{};
+
+      // parses the canonical text format, accepts upper case digits, hyphens after any group of four digits and surrounding braces
+      [[nodiscard]] static auto from_string( const std::string_view value ) -> uuid;
+
+      // the canonical text format with lower case digits, e.g. "a0eebc99-9c0b-4ef8-bb6d-6bb9bd380a11"
+      [[nodiscard]] auto to_string() const -> std::string;
+
+      [[nodiscard]] friend auto operator==( const uuid& lhs, const uuid& rhs ) noexcept
+      {
+         return lhs.bytes == rhs.bytes;
+      }
+
+      [[nodiscard]] friend auto operator!=( const uuid& lhs, const uuid& rhs ) noexcept
+      {
+         return lhs.bytes != rhs.bytes;
+      }
+
+      // the same order as the server's
+      [[nodiscard]] friend auto operator<( const uuid& lhs, const uuid& rhs ) noexcept
+      {
+         return lhs.bytes < rhs.bytes;
+      }
+   };
+
+}  // namespace tao::pq
+
+template<>
+struct std::hash< tao::pq::uuid >
+{
+   [[nodiscard]] auto operator()( const tao::pq::uuid& v ) const noexcept -> std::size_t
+   {
+      // the bits of a uuid are random enough, except for the version and variant bits in the middle
+      std::uint64_t h[ 2 ];
+      std::memcpy( h, v.bytes.data(), sizeof( h ) );
+      return static_cast< std::size_t >( h[ 0 ] ^ ( h[ 1 ] * 0x9e3779b97f4a7c15ULL ) );
+   }
+};
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/async_connection.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/internal/poll.hpp>
+
+namespace tao::pq
+{
+   async_connection::async_connection( const std::shared_ptr< connection >& connection )  // NOLINT(modernize-pass-by-value)
+      : m_connection( connection ),
+        // libpq requires to wait for the socket to become writable before the first call to PQconnectPoll()
+        m_status( connection->is_open() ? poll_status::ready : poll_status::wait_writable )
+   {}
+
+   auto async_connection::socket() const -> int
+   {
+      if( !m_connection ) {
+         throw std::logic_error( "async connection already retrieved" );
+      }
+      return m_connection->socket();
+   }
+
+   auto async_connection::poll() -> poll_status
+   {
+      if( !m_connection ) {
+         throw std::logic_error( "async connection already retrieved" );
+      }
+      m_status = m_connection->connect_poll();
+      return m_status;
+   }
+
+   auto async_connection::get() -> std::shared_ptr< connection >
+   {
+      if( !m_connection ) {
+         throw std::logic_error( "async connection already retrieved" );
+      }
+      while( m_status != poll_status::ready ) {
+         (void)internal::poll( socket(), m_status );
+         (void)poll();
+      }
+      return std::move( m_connection );
+   }
+
+}  // namespace tao::pq
@@ -0,0 +1,185 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/async_result.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/internal/poll.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   async_result::async_result( const std::shared_ptr< transaction >& transaction, const bool ends_transaction )  // NOLINT(modernize-pass-by-value)
+      : m_transaction( transaction ),
+        m_connection( transaction->m_connection ),
+        m_status( poll_status::wait_writable ),
+        m_ends_transaction( ends_transaction )
+   {
+      if( PQsetnonblocking( m_connection->m_pgconn.get(), 1 ) != 0 ) {
+         throw std::runtime_error( "unable to switch to non-blocking mode: " + m_connection->error_message() );  // LCOV_EXCL_LINE
+      }
+   }
+
+   async_result::async_result( result&& r ) noexcept
+      : m_status( poll_status::ready ),
+        m_ends_transaction( false ),
+        m_result( std::move( r ) )
+   {}
+
+   void async_result::finish() noexcept
+   {
+      PGconn* pgconn = m_connection->m_pgconn.get();
+      (void)PQsetnonblocking( pgconn, 0 );
+      // discard a result which was never retrieved, the connection would be unusable otherwise
+      while( PGresult* pgresult = PQgetResult( pgconn ) ) {
+         PQclear( pgresult );
+      }
+      if( m_ends_transaction ) {
+         m_transaction->v_reset();
+      }
+      m_transaction.reset();
+      m_connection.reset();
+   }
+
+   async_result::async_result( async_result&& other ) noexcept
+      : m_transaction( std::move( other.m_transaction ) ),
+        m_connection( std::move( other.m_connection ) ),
+        m_status( other.m_status ),
+        m_ends_transaction( other.m_ends_transaction ),
+        m_result( std::move( other.m_result ) )
+   {
+      other.m_result.reset();
+   }
+
+   async_result::~async_result()
+   {
+      if( m_transaction ) {
+         finish();
+      }
+   }
+
+   auto async_result::operator=( async_result&& other ) noexcept -> async_result&
+   {
+      if( this != &other ) {
+         if( m_transaction ) {
+            finish();
+         }
+         m_transaction = std::move( other.m_transaction );
+         m_connection = std::move( other.m_connection );
+         m_status = other.m_status;
+         m_ends_transaction = other.m_ends_transaction;
+         m_result.reset();
+         if( other.m_result ) {
+            m_result.emplace( std::move( *other.m_result ) );
+            other.m_result.reset();
+         }
+      }
+      return *this;
+   }
+
+   auto async_result::socket() const -> int
+   {
+      if( !m_transaction ) {
+         throw std::logic_error( "async result already retrieved" );
+      }
+      return m_connection->socket();
+   }
+
+   auto async_result::poll() -> poll_status
+   {
+      if( m_result ) {
+         return poll_status::ready;
+      }
+      if( !m_transaction ) {
+         throw std::logic_error( "async result already retrieved" );
+      }
+      PGconn* pgconn = m_connection->m_pgconn.get();
+      if( m_status == poll_status::wait_writable ) {
+         switch( PQflush( pgconn ) ) {
+            case 0:
+               break;
+
+            case 1:
+               return m_status;
+
+            default:
+               throw std::runtime_error( "PQflush() failed: " + m_connection->error_message() );
+         }
+      }
+      if( PQconsumeInput( pgconn ) == 0 ) {
+         throw std::runtime_error( "PQconsumeInput() failed: " + m_connection->error_message() );
+      }
+      m_status = ( PQisBusy( pgconn ) == 0 ) ? poll_status::ready : poll_status::wait_readable;
+      return m_status;
+   }
+
+   auto async_result::get_result( connection& c ) -> result
+   {
+      PGconn* pgconn = c.m_pgconn.get();
+      std::unique_ptr< PGresult, decltype( &PQclear ) > pgresult( nullptr, &PQclear );
+      while( true ) {
+         // PQgetResult() blocks while the input is incomplete, so read more input until it no longer does
+         while( PQisBusy( pgconn ) != 0 ) {
+            (void)internal::poll( c.socket(), poll_status::wait_readable );
+            if( PQconsumeInput( pgconn ) == 0 ) {
+               throw std::runtime_error( "PQconsumeInput() failed: " + c.error_message() );
+            }
+         }
+         PGresult* next = PQgetResult( pgconn );
+         if( next == nullptr ) {
+            break;
+         }
+         // keep the last result like PQexec() does, a COPY result is not followed by the terminating nullptr
+         pgresult.reset( next );
+         const auto status = PQresultStatus( next );
+         if( ( status == PGRES_COPY_IN ) || ( status == PGRES_COPY_OUT ) || ( status == PGRES_COPY_BOTH ) ) {
+            break;
+         }
+      }
+      if( !pgresult ) {
+         throw std::logic_error( "no result available" );
+      }
+      return result( pgresult.release() );
+   }
+
+   auto async_result::get() -> result
+   {
+      if( m_result ) {
+         result nrv = std::move( *m_result );
+         m_result.reset();
+         return nrv;
+      }
+      auto status = poll();
+      while( status != poll_status::ready ) {
+         (void)internal::poll( socket(), status );
+         status = poll();
+      }
+      // checked while the members are still set, so that the destructor discards the pending results if this throws
+      m_transaction->check_current_transaction();
+      const auto transaction = std::move( m_transaction );
+      const auto connection = std::move( m_connection );
+      try {
+         // the connection stays in non-blocking mode until all results are read
+         result nrv = get_result( *connection );
+         (void)PQsetnonblocking( connection->m_pgconn.get(), 0 );
+         if( m_ends_transaction ) {
+            transaction->v_reset();
+         }
+         return nrv;
+      }
+      catch( ... ) {
+         (void)PQsetnonblocking( connection->m_pgconn.get(), 0 );
+         if( m_ends_transaction ) {
+            transaction->v_reset();
+         }
+         throw;
+      }
+   }
+
+}  // namespace tao::pq
@@ -4,12 +4,16 @@
 #include <cassert>
 #include <cctype>
 #include <cstring>
+#include <new>
 #include <stdexcept>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <libpq-fe.h>
 
 #include <tao/pq/connection.hpp>
+#include <tao/pq/pipeline.hpp>
 
 namespace tao::pq
 {
@@ -20,6 +24,27 @@ namespace tao::pq
          return !value.empty() && ( value.find_first_not_of( "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_" ) == std::string_view::npos ) && ( std::isdigit( value[ 0 ] ) == 0 );
       }
 
+      // only these statements can be prepared, which also excludes the library's own transaction control statements
+      [[nodiscard]] auto is_preparable( const char* statement ) noexcept -> bool
+      {
+         while( std::isspace( static_cast< unsigned char >( *statement ) ) != 0 ) {
+            ++statement;
+         }
+         std::size_t size = 0;
+         while( ( size < 6 ) && ( std::isalpha( static_cast< unsigned char >( statement[ size ] ) ) != 0 ) ) {
+            ++size;
+         }
+         if( ( std::isalnum( static_cast< unsigned char >( statement[ size ] ) ) != 0 ) || ( statement[ size ] == '_' ) ) {
+            return false;
+         }
+         char keyword[ 6 ];
+         for( std::size_t i = 0; i < size; ++i ) {
+            keyword[ i ] = static_cast< char >( std::toupper( static_cast< unsigned char >( statement[ i ] ) ) );
+         }
+         const std::string_view sv( keyword, size );
+         return ( sv == "SELECT" ) || ( sv == "INSERT" ) || ( sv == "UPDATE" ) || ( sv == "DELETE" ) || ( sv == "MERGE" ) || ( sv == "VALUES" ) || ( sv == "WITH" ) || ( sv == "TABLE" );
+      }
+
       class transaction_base
          : public transaction
       {
@@ -133,12 +158,22 @@ namespace tao::pq
 
          void v_commit() override
          {
-            execute( "COMMIT TRANSACTION" );
+            execute( v_commit_statement() );
          }
 
          void v_rollback() override
          {
-            execute( "ROLLBACK TRANSACTION" );
+            execute( v_rollback_statement() );
+         }
+
+         [[nodiscard]] auto v_commit_statement() const -> std::string override
+         {
+            return "COMMIT TRANSACTION";
+         }
+
+         [[nodiscard]] auto v_rollback_statement() const -> std::string override
+         {
+            return "ROLLBACK TRANSACTION";
          }
       };
 
@@ -153,6 +188,15 @@ namespace tao::pq
 
    }  // namespace internal
 
+   auto connection::escape_identifier( const std::string& identifier ) const -> std::string
+   {
+      const std::unique_ptr< char, decltype( &PQfreemem ) > buffer( PQescapeIdentifier( m_pgconn.get(), identifier.data(), identifier.size() ), &PQfreemem );
+      if( !buffer ) {
+         throw std::invalid_argument( "escaping identifier failed: " + error_message() );
+      }
+      return buffer.get();
+   }
+
    auto connection::error_message() const -> std::string
    {
       const char* message = PQerrorMessage( m_pgconn.get() );
@@ -175,23 +219,134 @@ namespace tao::pq
       return m_prepared_statements.find( name ) != m_prepared_statements.end();
    }
 
-   auto connection::execute_params( const char* statement,
-                                    const int n_params,
-                                    const Oid types[],
-                                    const char* const values[],
-                                    const int lengths[],
-                                    const int formats[] ) -> result
+   auto connection::auto_prepared( const char* statement, const int n_params, const Oid types[] ) -> const char*
+   {
+      if( !m_prepared_cache && m_deallocate_pending.empty() ) {
+         return nullptr;
+      }
+      PGconn* pgconn = m_pgconn.get();
+      // preparing requires an idle connection which is not in pipeline mode and not in an aborted transaction
+      const auto status = PQtransactionStatus( pgconn );
+      if( ( status == PQTRANS_ACTIVE ) || ( status == PQTRANS_INERROR ) ) {
+         return nullptr;
+      }
+#if defined( LIBPQ_HAS_PIPELINING )
+      if( PQpipelineStatus( pgconn ) != PQ_PIPELINE_OFF ) {
+         return nullptr;
+      }
+#endif
+      // in non-blocking mode, i.e. for async results, statements which are already prepared are used but no additional
+      // round trips are made, preparing and deallocating is deferred to the next synchronous statement
+      const bool nonblocking = ( PQisnonblocking( pgconn ) != 0 );
+      if( !nonblocking && !m_deallocate_pending.empty() ) {
+         deallocate_auto_prepared( std::exchange( m_deallocate_pending, {} ) );
+      }
+      if( !m_prepared_cache || !is_preparable( statement ) ) {
+         return nullptr;
+      }
+      std::vector< std::string > evicted;
+      auto& entry = m_prepared_cache->use( statement, n_params, types, evicted );
+      if( nonblocking ) {
+         for( auto& name : evicted ) {
+            m_deallocate_pending.emplace_back( std::move( name ) );
+         }
+         return entry.name.empty() ? nullptr : entry.name.c_str();
+      }
+      if( !evicted.empty() ) {
+         deallocate_auto_prepared( std::move( evicted ) );
+      }
+      if( entry.name.empty() && ( ++entry.count >= m_prepared_cache->threshold() ) ) {
+         std::string name = m_prepared_cache->next_name();
+         const std::unique_ptr< PGresult, decltype( &PQclear ) > pgresult( PQprepare( pgconn, name.c_str(), statement, n_params, types ), &PQclear );
+         if( PQresultStatus( pgresult.get() ) == PGRES_COMMAND_OK ) {
+            entry.name = std::move( name );
+         }
+         else {
+            // the statement itself reports the error, retry preparing later
+            entry.count = 0;
+         }
+      }
+      return entry.name.empty() ? nullptr : entry.name.c_str();
+   }
+
+   void connection::deallocate_auto_prepared( std::vector< std::string >&& names )
+   {
+      for( auto& name : names ) {
+         // DEALLOCATE fails inside an aborted transaction, retry once the transaction has ended
+         if( PQtransactionStatus( m_pgconn.get() ) == PQTRANS_INERROR ) {
+            m_deallocate_pending.emplace_back( std::move( name ) );
+            continue;
+         }
+         // any other failure leaves an unused statement on the server, which is harmless
+         PQclear( PQexec( m_pgconn.get(), ( "DEALLOCATE " + name ).c_str() ) );
+      }
+   }
+
+   void connection::send_params( const char* statement,
+                                 const int n_params,
+                                 const Oid types[],
+                                 const char* const values[],
+                                 const int lengths[],
+                                 const int formats[],
+                                 const result_format format )
+   {
+      const char* name = is_prepared( statement ) ? statement : auto_prepared( statement, n_params, types );
+      if( name != nullptr ) {
+         send_prepared( name, n_params, values, lengths, formats, format );
+         return;
+      }
+      if( PQsendQueryParams( m_pgconn.get(), statement, n_params, types, values, lengths, formats, static_cast< int >( format ) ) != 1 ) {
+         throw std::runtime_error( "sending statement failed: " + error_message() );
+      }
+   }
+
+   void connection::send_prepared( const char* name,
+                                   const int n_params,
+                                   const char* const values[],
+                                   const int lengths[],
+                                   const int formats[],
+                                   const result_format format )
+   {
+      if( PQsendQueryPrepared( m_pgconn.get(), name, n_params, values, lengths, formats, static_cast< int >( format ) ) != 1 ) {
+         throw std::runtime_error( "sending statement failed: " + error_message() );
+      }
+   }
+
+   auto connection::get_result() -> result
    {
-      if( is_prepared( statement ) ) {
-         return result( PQexecPrepared( m_pgconn.get(), statement, n_params, values, lengths, formats, 0 ) );
+      PGresult* pgresult = PQgetResult( m_pgconn.get() );
+      if( pgresult == nullptr ) {
+         throw std::logic_error( "no result available" );
       }
-      return result( PQexecParams( m_pgconn.get(), statement, n_params, types, values, lengths, formats, 0 ) );
+      switch( PQresultStatus( pgresult ) ) {
+         case PGRES_COPY_IN:
+         case PGRES_COPY_OUT:
+         case PGRES_COPY_BOTH:
+            break;
+
+         default:
+            // consume the results up to the terminating nullptr, keep the last one like PQexec() does
+            while( PGresult* next = PQgetResult( m_pgconn.get() ) ) {
+               PQclear( pgresult );
+               pgresult = next;
+            }
+      }
+      return result( pgresult );
    }
 
-   connection::connection( const connection::private_key& /*unused*/, const std::string& connection_info )
-      : m_pgconn( PQconnectdb( connection_info.c_str() ), internal::deleter() ),
+   connection::connection( const connection::private_key& /*unused*/, const std::string& connection_info, const bool async )
+      : m_pgconn( async ? PQconnectStart( connection_info.c_str() ) : PQconnectdb( connection_info.c_str() ), internal::deleter() ),
         m_current_transaction( nullptr )
    {
+      if( !m_pgconn ) {
+         throw std::bad_alloc();  // LCOV_EXCL_LINE
+      }
+      if( async ) {
+         if( PQstatus( m_pgconn.get() ) == CONNECTION_BAD ) {
+            throw std::runtime_error( "connection failed: " + error_message() );
+         }
+         return;
+      }
       if( !is_open() ) {
          throw std::runtime_error( "connection failed: " + error_message() );
       }
@@ -207,16 +362,97 @@ namespace tao::pq
       return std::make_shared< connection >( private_key(), connection_info );
    }
 
+   auto connection::create_async( const std::string& connection_info ) -> std::shared_ptr< connection >
+   {
+      return std::make_shared< connection >( private_key(), connection_info, true );
+   }
+
    auto connection::is_open() const noexcept -> bool
    {
       return PQstatus( m_pgconn.get() ) == CONNECTION_OK;
    }
 
-   void connection::prepare( const std::string& name, const std::string& statement )
+   auto connection::socket() const -> int
+   {
+      const int s = PQsocket( m_pgconn.get() );
+      if( s < 0 ) {
+         throw std::runtime_error( "connection has no valid socket" );
+      }
+      return s;
+   }
+
+   auto connection::connect_poll() -> poll_status
+   {
+      if( is_open() ) {
+         return poll_status::ready;
+      }
+      switch( PQconnectPoll( m_pgconn.get() ) ) {
+         case PGRES_POLLING_READING:
+            return poll_status::wait_readable;
+
+         case PGRES_POLLING_WRITING:
+            return poll_status::wait_writable;
+
+         case PGRES_POLLING_OK:
+            if( PQprotocolVersion( m_pgconn.get() ) < 3 ) {
+               throw std::runtime_error( "protocol version 3 required" );  // LCOV_EXCL_LINE
+            }
+            return poll_status::ready;
+
+         case PGRES_POLLING_FAILED:
+         default:
+            throw std::runtime_error( "connection failed: " + error_message() );
+      }
+   }
+
+   auto connection::prepare( const std::string& name, const std::string& statement, const std::vector< Oid >& types ) -> prepared_statement
    {
       check_prepared_name( name );
-      result( PQprepare( m_pgconn.get(), name.c_str(), statement.c_str(), 0, nullptr ) );  // NOLINT(bugprone-unused-raii)
+      result( PQprepare( m_pgconn.get(), name.c_str(), statement.c_str(), static_cast< int >( types.size() ), types.empty() ? nullptr : types.data() ) );  // NOLINT(bugprone-unused-raii)
       m_prepared_statements.insert( name );
+      return prepared_statement( name, types );
+   }
+
+   void connection::set_auto_prepare( const std::size_t capacity, const std::size_t threshold )
+   {
+      if( m_prepared_cache ) {
+         deallocate_auto_prepared( m_prepared_cache->clear() );
+         m_prepared_cache.reset();
+      }
+      if( capacity > 0 ) {
+         m_prepared_cache.emplace( capacity, threshold );
+      }
+   }
+
+   void connection::listen( const std::string& channel )
+   {
+      execute( "LISTEN " + escape_identifier( channel ) );
+   }
+
+   void connection::unlisten( const std::string& channel )
+   {
+      execute( "UNLISTEN " + escape_identifier( channel ) );
+   }
+
+   void connection::notify( const std::string& channel, const std::string& payload )
+   {
+      execute( "SELECT pg_notify( $1, $2 )", channel, payload );
+   }
+
+   auto connection::get_notification() -> std::optional< notification >
+   {
+      if( PQconsumeInput( m_pgconn.get() ) == 0 ) {
+         throw std::runtime_error( "PQconsumeInput() failed: " + error_message() );
+      }
+      if( PGnotify* pgnotify = PQnotifies( m_pgconn.get() ) ) {
+         return notification( pgnotify );
+      }
+      return std::nullopt;
+   }
+
+   void connection::deallocate( const prepared_statement& statement )
+   {
+      deallocate( statement.name() );
    }
 
    void connection::deallocate( const std::string& name )
@@ -239,4 +475,9 @@ namespace tao::pq
       return std::make_shared< top_level_transaction >( il, shared_from_this() );
    }
 
+   auto connection::pipeline() -> std::shared_ptr< pq::pipeline >
+   {
+      return direct()->pipeline();
+   }
+
 }  // namespace tao::pq
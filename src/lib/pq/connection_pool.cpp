@@ -3,6 +3,15 @@
 
 #include <tao/pq/connection_pool.hpp>
 
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <tao/pq/internal/poll.hpp>
+#include <tao/pq/internal/printf.hpp>
+
 namespace tao::pq
 {
    auto connection_pool::v_create() const -> std::unique_ptr< pq::connection >
@@ -20,4 +29,67 @@ namespace tao::pq
       return std::make_shared< connection_pool >( connection_pool::private_key(), connection_info );
    }
 
+   auto connection_pool::async_connection() -> pq::async_connection
+   {
+      if( auto sp = this->try_get() ) {
+         return pq::async_connection( sp );
+      }
+      return pq::async_connection( this->adopt( std::make_unique< pq::connection >( connection::private_key(), m_connection_info, true ) ) );
+   }
+
+   void connection_pool::warm_up( const std::size_t n, const std::chrono::milliseconds timeout )
+   {
+      const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+      std::vector< std::unique_ptr< pq::connection > > pending;
+      std::vector< internal::poll_request > requests;
+      pending.reserve( n );
+      requests.reserve( n );
+      for( std::size_t i = 0; i < n; ++i ) {
+         // libpq requires to wait for the socket to become writable before the first call to PQconnectPoll()
+         pending.emplace_back( std::make_unique< pq::connection >( connection::private_key(), m_connection_info, true ) );
+         requests.push_back( { pending.back()->socket(), poll_status::wait_writable, false } );
+      }
+
+      // all handshakes are driven together over a single poll set, each one progresses as soon as its socket is ready
+      std::exception_ptr error;
+      while( !pending.empty() ) {
+         const auto remaining = std::chrono::duration_cast< std::chrono::milliseconds >( deadline - std::chrono::steady_clock::now() ).count();
+         if( ( remaining <= 0 ) || !internal::poll( requests, static_cast< int >( std::min< decltype( remaining ) >( remaining, std::numeric_limits< int >::max() ) ) ) ) {
+            if( !error ) {
+               error = std::make_exception_ptr( std::runtime_error( internal::printf( "timeout while warming up connection pool, %zu of %zu connections pending", pending.size(), n ) ) );
+            }
+            break;
+         }
+         std::size_t j = 0;
+         for( std::size_t i = 0; i < pending.size(); ++i ) {
+            if( requests[ i ].ready ) {
+               try {
+                  requests[ i ].status = pending[ i ]->connect_poll();
+                  if( requests[ i ].status == poll_status::ready ) {
+                     push( pending[ i ] );
+                     continue;
+                  }
+                  // libpq may switch to a different socket while trying multiple hosts
+                  requests[ i ].socket = pending[ i ]->socket();
+               }
+               catch( ... ) {
+                  if( !error ) {
+                     error = std::current_exception();
+                  }
+                  continue;
+               }
+            }
+            pending[ j ] = std::move( pending[ i ] );
+            requests[ j ] = requests[ i ];
+            ++j;
+         }
+         pending.resize( j );
+         requests.resize( j );
+      }
+      if( error ) {
+         std::rethrow_exception( error );
+      }
+   }
+
 }  // namespace tao::pq
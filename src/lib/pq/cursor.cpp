@@ -0,0 +1,100 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/cursor.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+#include <tao/pq/internal/printf.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   cursor::cursor( const private_key& /*unused*/, const std::shared_ptr< transaction >& transaction, const std::size_t fetch_size )  // NOLINT(modernize-pass-by-value)
+      : m_transaction( transaction ),
+        m_name( internal::printf( "\"TAOPQ_%p\"", static_cast< void* >( this ) ) ),
+        m_fetch( internal::printf( "FETCH FORWARD %zu FROM ", fetch_size ) + m_name ),
+        m_fetch_size( fetch_size ),
+        m_row( 0 ),
+        m_declared( false ),
+        m_pending( false ),
+        m_done( false )
+   {
+      if( fetch_size == 0 ) {
+         throw std::invalid_argument( "invalid fetch size 0" );
+      }
+   }
+
+   cursor::~cursor()
+   {
+      if( m_declared || m_pending ) {
+         try {
+            close();
+         }
+         // LCOV_EXCL_START
+         catch( const std::exception& ) {
+            // TAO_LOG( WARNING, "unable to close cursor, swallowing exception: " + std::string( e.what() ) );
+         }
+         catch( ... ) {
+            // TAO_LOG( WARNING, "unable to close cursor, swallowing unknown exception" );
+         }
+         // LCOV_EXCL_STOP
+      }
+   }
+
+   auto cursor::declare( const char* statement, const bool with_hold ) const -> std::string
+   {
+      return "DECLARE " + m_name + ( with_hold ? " NO SCROLL CURSOR WITH HOLD FOR " : " NO SCROLL CURSOR FOR " ) + statement;
+   }
+
+   void cursor::start()
+   {
+      m_declared = true;
+      send_fetch();
+      receive();
+   }
+
+   void cursor::send_fetch()
+   {
+      m_transaction->send( m_fetch );
+      m_pending = true;
+   }
+
+   void cursor::receive()
+   {
+      m_pending = false;
+      m_done = true;
+      result r = m_transaction->get_result();
+      m_result.emplace( std::move( r ) );
+      m_row = 0;
+      if( m_result->m_rows == m_fetch_size ) {
+         // prefetch, the server produces the next batch while the current one is processed
+         send_fetch();
+         m_done = false;
+      }
+   }
+
+   void cursor::advance()
+   {
+      ++m_row;
+      while( !m_done && ( m_row >= m_result->m_rows ) ) {
+         receive();
+      }
+   }
+
+   void cursor::close()
+   {
+      m_done = true;
+      m_result.reset();
+      if( m_pending ) {
+         m_pending = false;
+         (void)m_transaction->get_result();
+      }
+      if( m_declared ) {
+         m_declared = false;
+         m_transaction->execute( "CLOSE " + m_name );
+      }
+   }
+
+}  // namespace tao::pq
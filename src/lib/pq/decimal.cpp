@@ -0,0 +1,71 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/decimal.hpp>
+
+#include <stdexcept>
+
+#include <tao/pq/internal/numeric.hpp>
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq
+{
+   auto decimal::from_string( const std::string_view value ) -> decimal
+   {
+      std::string_view digits = value;
+      const bool negative = !digits.empty() && ( digits.front() == '-' );
+      if( negative || ( !digits.empty() && ( digits.front() == '+' ) ) ) {
+         digits.remove_prefix( 1 );
+      }
+      unsigned_coefficient_type magnitude = 0;
+      int nrv_scale = 0;
+      bool point = false;
+      bool any = false;
+      for( const char c : digits ) {
+         if( ( c == '.' ) && !point ) {
+            point = true;
+            continue;
+         }
+         if( ( c < '0' ) || ( c > '9' ) ) {
+            throw std::invalid_argument( "invalid value in tao::pq::decimal for input: " + std::string( value ) );
+         }
+         const auto digit = static_cast< unsigned >( c - '0' );
+         if( magnitude > ( max_magnitude - digit ) / 10 ) {
+            throw std::overflow_error( "overflow error in tao::pq::decimal for input: " + std::string( value ) );
+         }
+         magnitude = magnitude * 10 + digit;
+         if( point && ( ++nrv_scale > max_scale ) ) {
+            throw std::overflow_error( "scale overflow error in tao::pq::decimal for input: " + std::string( value ) );
+         }
+         any = true;
+      }
+      if( !any ) {
+         throw std::invalid_argument( "invalid value in tao::pq::decimal for input: " + std::string( value ) );
+      }
+      const auto nrv = static_cast< coefficient_type >( magnitude );
+      return decimal{ negative ? -nrv : nrv, nrv_scale };
+   }
+
+   auto decimal::to_string() const -> std::string
+   {
+      if( ( scale < 0 ) || ( scale > max_scale ) ) {
+         throw std::out_of_range( internal::printf( "invalid scale in tao::pq::decimal: %d", scale ) );
+      }
+      const bool negative = coefficient < 0;
+      const auto magnitude = negative ? ( unsigned_coefficient_type( 0 ) - static_cast< unsigned_coefficient_type >( coefficient ) ) : static_cast< unsigned_coefficient_type >( coefficient );
+      char buffer[ internal::magnitude_buffer_size ];
+      std::string nrv( internal::magnitude_digits( buffer, magnitude ) );
+      const auto fractional = static_cast< std::size_t >( scale );
+      if( nrv.size() <= fractional ) {
+         nrv.insert( 0, fractional + 1 - nrv.size(), '0' );
+      }
+      if( fractional != 0 ) {
+         nrv.insert( nrv.size() - fractional, 1, '.' );
+      }
+      if( negative ) {
+         nrv.insert( 0, 1, '-' );
+      }
+      return nrv;
+   }
+
+}  // namespace tao::pq
@@ -0,0 +1,105 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined( _WIN32 )
+#include <winsock2.h>
+#else
+#include <poll.h>
+#endif
+
+#include <tao/pq/event_loop.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      class current_guard
+      {
+      private:
+         scheduler* const m_previous;
+
+      public:
+         explicit current_guard( scheduler* s ) noexcept
+            : m_previous( scheduler::current() )
+         {
+            scheduler::set_current( s );
+         }
+
+         ~current_guard()
+         {
+            scheduler::set_current( m_previous );
+         }
+
+         current_guard( const current_guard& ) = delete;
+         current_guard( current_guard&& ) = delete;
+         void operator=( const current_guard& ) = delete;
+         void operator=( current_guard&& ) = delete;
+      };
+
+   }  // namespace
+
+   void event_loop::wait( const int socket, const poll_status status, std::function< void() > callback )
+   {
+      m_waiting.push_back( { socket, status, std::move( callback ) } );
+   }
+
+   void event_loop::run()
+   {
+      const current_guard guard( this );
+      std::vector< pollfd > pfds;
+      std::vector< std::function< void() > > callbacks;
+      while( !m_waiting.empty() ) {
+         pfds.clear();
+         bool immediate = false;
+         for( const auto& w : m_waiting ) {
+            pollfd pfd = {};
+            if( w.status == poll_status::ready ) {
+               pfd.fd = -1;  // ignored by poll(), the callback is invoked right away
+               immediate = true;
+            }
+            else {
+               pfd.fd = w.socket;
+               pfd.events = ( w.status == poll_status::wait_writable ) ? POLLOUT : POLLIN;
+            }
+            pfds.push_back( pfd );
+         }
+#if defined( _WIN32 )
+         if( ::WSAPoll( pfds.data(), static_cast< ULONG >( pfds.size() ), immediate ? 0 : -1 ) < 0 ) {
+            throw std::runtime_error( "WSAPoll() failed with error " + std::to_string( ::WSAGetLastError() ) );  // LCOV_EXCL_LINE
+         }
+#else
+         if( ::poll( pfds.data(), pfds.size(), immediate ? 0 : -1 ) < 0 ) {
+            if( errno == EINTR ) {
+               continue;  // LCOV_EXCL_LINE
+            }
+            throw std::runtime_error( std::string( "poll() failed: " ) + std::strerror( errno ) );  // LCOV_EXCL_LINE
+         }
+#endif
+         // collect first, callbacks may register new waits
+         callbacks.clear();
+         std::size_t j = 0;
+         for( std::size_t i = 0; i < m_waiting.size(); ++i ) {
+            if( ( m_waiting[ i ].status == poll_status::ready ) || ( pfds[ i ].revents != 0 ) ) {
+               callbacks.emplace_back( std::move( m_waiting[ i ].callback ) );
+            }
+            else {
+               if( i != j ) {
+                  m_waiting[ j ] = std::move( m_waiting[ i ] );
+               }
+               ++j;
+            }
+         }
+         m_waiting.erase( m_waiting.begin() + j, m_waiting.end() );
+         for( const auto& callback : callbacks ) {
+            callback();
+         }
+      }
+   }
+
+}  // namespace tao::pq
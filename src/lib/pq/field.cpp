@@ -21,4 +21,19 @@ namespace tao::pq
       return m_row.get( m_column );
    }
 
+   auto field::is_binary() const -> bool
+   {
+      return m_row.is_binary( m_column );
+   }
+
+   auto field::length() const -> std::size_t
+   {
+      return m_row.length( m_column );
+   }
+
+   auto field::view() const -> std::string_view
+   {
+      return as< std::string_view >();
+   }
+
 }  // namespace tao::pq
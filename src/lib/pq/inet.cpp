@@ -0,0 +1,230 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/inet.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+
+#include <tao/pq/internal/hex.hpp>
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      [[nodiscard]] auto invalid( const std::string_view value ) -> std::invalid_argument
+      {
+         return std::invalid_argument( "invalid value in tao::pq::inet for input: " + std::string( value ) );
+      }
+
+      // parses up to 'max' decimal digits, returns -1 if there are none
+      [[nodiscard]] auto parse_decimal( std::string_view& in, const std::size_t max ) noexcept -> int
+      {
+         int nrv = -1;
+         std::size_t n = 0;
+         while( !in.empty() && ( in.front() >= '0' ) && ( in.front() <= '9' ) && ( n < max ) ) {
+            nrv = ( ( nrv < 0 ) ? 0 : nrv * 10 ) + ( in.front() - '0' );
+            in.remove_prefix( 1 );
+            ++n;
+         }
+         return nrv;
+      }
+
+      [[nodiscard]] auto parse_ipv4( std::string_view& in, unsigned char* out ) noexcept -> bool
+      {
+         for( int i = 0; i < 4; ++i ) {
+            if( i != 0 ) {
+               if( in.empty() || ( in.front() != '.' ) ) {
+                  return false;
+               }
+               in.remove_prefix( 1 );
+            }
+            const int v = parse_decimal( in, 3 );
+            if( ( v < 0 ) || ( v > 255 ) ) {
+               return false;
+            }
+            out[ i ] = static_cast< unsigned char >( v );
+         }
+         return true;
+      }
+
+      [[nodiscard]] auto parse_ipv6( std::string_view& in, unsigned char* out ) noexcept -> bool
+      {
+         unsigned char words[ 16 ] = {};
+         std::size_t n = 0;
+         std::size_t gap = 16;  // the position of "::", if any
+         if( ( in.size() >= 2 ) && ( in[ 0 ] == ':' ) && ( in[ 1 ] == ':' ) ) {
+            in.remove_prefix( 2 );
+            gap = 0;
+         }
+         while( !in.empty() && ( in.front() != '/' ) && ( n < 16 ) ) {
+            // an IPv4 address is only allowed as the last two words
+            const auto dot = in.find_first_of( ".:/" );
+            if( ( dot != std::string_view::npos ) && ( in[ dot ] == '.' ) ) {
+               if( ( n > 12 ) || !parse_ipv4( in, words + n ) ) {
+                  return false;
+               }
+               n += 4;
+               break;
+            }
+            int v = 0;
+            std::size_t digits = 0;
+            while( !in.empty() && ( internal::hex_value( in.front() ) >= 0 ) && ( digits < 4 ) ) {
+               v = v * 16 + internal::hex_value( in.front() );
+               in.remove_prefix( 1 );
+               ++digits;
+            }
+            if( digits == 0 ) {
+               return false;
+            }
+            words[ n++ ] = static_cast< unsigned char >( v >> 8 );
+            words[ n++ ] = static_cast< unsigned char >( v & 0xFF );
+            if( in.empty() || ( in.front() == '/' ) ) {
+               break;
+            }
+            if( in.front() != ':' ) {
+               return false;
+            }
+            in.remove_prefix( 1 );
+            if( !in.empty() && ( in.front() == ':' ) ) {
+               if( gap != 16 ) {
+                  return false;
+               }
+               in.remove_prefix( 1 );
+               gap = n;
+            }
+            else if( in.empty() || ( in.front() == '/' ) ) {
+               return false;
+            }
+         }
+         if( gap == 16 ) {
+            if( n != 16 ) {
+               return false;
+            }
+            std::copy( words, words + 16, out );
+            return true;
+         }
+         if( n == 16 ) {
+            return false;
+         }
+         // move the words after the gap to the end
+         std::fill( out, out + 16, 0 );
+         std::copy( words, words + gap, out );
+         std::copy( words + gap, words + n, out + 16 - ( n - gap ) );
+         return true;
+      }
+
+      [[nodiscard]] auto format_ipv4( const unsigned char* in ) -> std::string
+      {
+         return internal::printf( "%u.%u.%u.%u", in[ 0 ], in[ 1 ], in[ 2 ], in[ 3 ] );
+      }
+
+      // compresses the longest run of at least two zero words, and writes the last four bytes
+      // of IPv4-compatible and IPv4-mapped addresses as an IPv4 address, just like the server
+      [[nodiscard]] auto format_ipv6( const unsigned char* in ) -> std::string
+      {
+         unsigned words[ 8 ];
+         for( std::size_t i = 0; i < 8; ++i ) {
+            words[ i ] = ( unsigned( in[ 2 * i ] ) << 8 ) | in[ 2 * i + 1 ];
+         }
+         std::size_t best = 8;
+         std::size_t best_length = 1;
+         for( std::size_t i = 0; i < 8; ) {
+            std::size_t j = i;
+            while( ( j < 8 ) && ( words[ j ] == 0 ) ) {
+               ++j;
+            }
+            if( j - i > best_length ) {
+               best = i;
+               best_length = j - i;
+            }
+            i = ( j == i ) ? i + 1 : j;
+         }
+         std::string nrv;
+         for( std::size_t i = 0; i < 8; ++i ) {
+            if( i == best ) {
+               nrv += ( i == 0 ) ? "::" : ":";
+               i += best_length - 1;
+               continue;
+            }
+            if( ( i == 6 ) && ( best == 0 ) && ( ( best_length == 6 ) || ( ( best_length == 7 ) && ( words[ 7 ] != 1 ) ) || ( ( best_length == 5 ) && ( words[ 5 ] == 0xFFFF ) ) ) ) {
+               nrv += format_ipv4( in + 12 );
+               break;
+            }
+            char buffer[ 8 ];
+            nrv.append( buffer, static_cast< std::size_t >( std::snprintf( buffer, sizeof( buffer ), "%x", words[ i ] ) ) );
+            if( i != 7 ) {
+               nrv += ':';
+            }
+         }
+         return nrv;
+      }
+
+   }  // namespace
+
+   auto inet::from_string( const std::string_view value ) -> inet
+   {
+      std::string_view in = value;
+      inet nrv;
+      if( in.find( ':' ) == std::string_view::npos ) {
+         if( !parse_ipv4( in, nrv.address.data() ) ) {
+            throw invalid( value );
+         }
+      }
+      else {
+         nrv.family = family_type::ipv6;
+         if( !parse_ipv6( in, nrv.address.data() ) ) {
+            throw invalid( value );
+         }
+      }
+      nrv.bits = static_cast< unsigned char >( nrv.max_bits() );
+      if( !in.empty() && ( in.front() == '/' ) ) {
+         in.remove_prefix( 1 );
+         const int v = parse_decimal( in, 3 );
+         if( ( v < 0 ) || ( static_cast< unsigned >( v ) > nrv.max_bits() ) ) {
+            throw invalid( value );
+         }
+         nrv.bits = static_cast< unsigned char >( v );
+      }
+      if( !in.empty() ) {
+         throw invalid( value );
+      }
+      return nrv;
+   }
+
+   auto inet::to_string() const -> std::string
+   {
+      std::string nrv = ( family == family_type::ipv4 ) ? format_ipv4( address.data() ) : format_ipv6( address.data() );
+      if( bits != max_bits() ) {
+         nrv += internal::printf( "/%u", unsigned( bits ) );
+      }
+      return nrv;
+   }
+
+   auto cidr::from_string( const std::string_view value ) -> cidr
+   {
+      cidr nrv{ inet::from_string( value ) };
+      nrv.validate();
+      return nrv;
+   }
+
+   auto cidr::to_string() const -> std::string
+   {
+      return inet::to_string() + ( ( bits == max_bits() ) ? internal::printf( "/%u", unsigned( bits ) ) : std::string() );
+   }
+
+   void cidr::validate() const
+   {
+      if( bits > max_bits() ) {
+         throw std::invalid_argument( internal::printf( "invalid netmask in tao::pq::cidr: %u bits", unsigned( bits ) ) );
+      }
+      for( std::size_t i = bits; i < max_bits(); ++i ) {
+         if( ( address[ i / 8 ] & ( 0x80 >> ( i % 8 ) ) ) != 0 ) {
+            throw std::invalid_argument( "invalid value in tao::pq::cidr, bits are set to the right of the netmask: " + to_string() );
+         }
+      }
+   }
+
+}  // namespace tao::pq
@@ -0,0 +1,301 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/internal/array.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq::internal
+{
+   namespace
+   {
+      [[nodiscard]] auto needs_quotes( const char* value ) noexcept -> bool
+      {
+         if( ( *value == '\0' ) || ( ( std::strlen( value ) == 4 ) && ( ( value[ 0 ] | 0x20 ) == 'n' ) && ( ( value[ 1 ] | 0x20 ) == 'u' ) && ( ( value[ 2 ] | 0x20 ) == 'l' ) && ( ( value[ 3 ] | 0x20 ) == 'l' ) ) ) {
+            return true;
+         }
+         for( const char* p = value; *p != '\0'; ++p ) {
+            switch( *p ) {
+               case '{':
+               case '}':
+               case ',':
+               case '"':
+               case '\\':
+               case ' ':
+               case '\t':
+               case '\n':
+               case '\r':
+               case '\v':
+               case '\f':
+                  return true;
+            }
+         }
+         return false;
+      }
+
+      [[nodiscard]] auto get_int32( const char* p ) noexcept -> std::int32_t
+      {
+         const auto* u = reinterpret_cast< const unsigned char* >( p );
+         return static_cast< std::int32_t >( ( std::uint32_t( u[ 0 ] ) << 24 ) | ( std::uint32_t( u[ 1 ] ) << 16 ) | ( std::uint32_t( u[ 2 ] ) << 8 ) | std::uint32_t( u[ 3 ] ) );
+      }
+
+   }  // namespace
+
+   void append_array_element( std::string& buffer, const char* value )
+   {
+      if( value == nullptr ) {
+         buffer += "NULL";
+      }
+      else if( !needs_quotes( value ) ) {
+         buffer += value;
+      }
+      else {
+         buffer += '"';
+         for( const char* p = value; *p != '\0'; ++p ) {
+            if( ( *p == '"' ) || ( *p == '\\' ) ) {
+               buffer += '\\';
+            }
+            buffer += *p;
+         }
+         buffer += '"';
+      }
+   }
+
+   void append_array_int32( std::string& buffer, const std::int32_t value )
+   {
+      const auto v = static_cast< std::uint32_t >( value );
+      const char bytes[] = { static_cast< char >( v >> 24 ), static_cast< char >( ( v >> 16 ) & 0xFF ), static_cast< char >( ( v >> 8 ) & 0xFF ), static_cast< char >( v & 0xFF ) };
+      buffer.append( bytes, sizeof( bytes ) );
+   }
+
+   array_text_parser::array_text_parser( const char* value, const std::size_t size )
+      : m_p( value ),
+        m_end( value + size )
+   {
+      skip_whitespace();
+      if( ( m_p != m_end ) && ( *m_p == '[' ) ) {
+         while( ( m_p != m_end ) && ( *m_p != '=' ) ) {
+            ++m_p;
+         }
+         if( m_p == m_end ) {
+            invalid();
+         }
+         ++m_p;
+      }
+   }
+
+   void array_text_parser::skip_whitespace() noexcept
+   {
+      while( ( m_p != m_end ) && ( ( *m_p == ' ' ) || ( ( *m_p >= '\t' ) && ( *m_p <= '\r' ) ) ) ) {
+         ++m_p;
+      }
+   }
+
+   void array_text_parser::invalid() const
+   {
+      throw std::runtime_error( "invalid array in tao::pq::result_traits at: " + std::string( m_p, m_end ) );
+   }
+
+   auto array_text_parser::count() const noexcept -> std::size_t
+   {
+      std::size_t depth = 0;
+      std::size_t nrv = 1;
+      bool quoted = false;
+      for( const char* p = m_p; p != m_end; ++p ) {
+         if( *p == '\\' ) {
+            if( ++p == m_end ) {
+               break;
+            }
+         }
+         else if( *p == '"' ) {
+            quoted = !quoted;
+         }
+         else if( !quoted ) {
+            if( *p == '{' ) {
+               ++depth;
+            }
+            else if( *p == '}' ) {
+               if( --depth == 0 ) {
+                  break;
+               }
+            }
+            else if( ( *p == ',' ) && ( depth == 1 ) ) {
+               ++nrv;
+            }
+         }
+      }
+      return nrv;
+   }
+
+   auto array_text_parser::open() -> bool
+   {
+      skip_whitespace();
+      if( ( m_p == m_end ) || ( *m_p != '{' ) ) {
+         invalid();
+      }
+      ++m_p;
+      skip_whitespace();
+      if( ( m_p != m_end ) && ( *m_p == '}' ) ) {
+         ++m_p;
+         return false;
+      }
+      return true;
+   }
+
+   auto array_text_parser::next() -> bool
+   {
+      skip_whitespace();
+      if( m_p != m_end ) {
+         switch( *m_p++ ) {
+            case ',':
+               return true;
+            case '}':
+               return false;
+         }
+         --m_p;
+      }
+      invalid();
+   }
+
+   auto array_text_parser::element( std::string& scratch ) -> array_element
+   {
+      skip_whitespace();
+      if( ( m_p == m_end ) || ( *m_p == '{' ) || ( *m_p == '}' ) || ( *m_p == ',' ) ) {
+         invalid();
+      }
+      if( *m_p == '"' ) {
+         const char* const begin = ++m_p;
+         while( ( m_p != m_end ) && ( *m_p != '"' ) && ( *m_p != '\\' ) ) {
+            ++m_p;
+         }
+         if( m_p == m_end ) {
+            invalid();
+         }
+         if( *m_p == '"' ) {
+            return { begin, static_cast< std::size_t >( m_p++ - begin ), false };
+         }
+         // unescape into the scratch buffer
+         scratch.assign( begin, m_p );
+         while( ( m_p != m_end ) && ( *m_p != '"' ) ) {
+            if( ( *m_p == '\\' ) && ( ++m_p == m_end ) ) {
+               break;
+            }
+            scratch += *m_p++;
+         }
+         if( m_p == m_end ) {
+            invalid();
+         }
+         ++m_p;
+         return { scratch.c_str(), scratch.size(), true };
+      }
+      const char* const begin = m_p;
+      const char* end = m_p;  // trailing whitespace is ignored unless it was escaped
+      bool escaped = false;
+      while( ( m_p != m_end ) && ( *m_p != ',' ) && ( *m_p != '}' ) ) {
+         if( *m_p == '\\' ) {
+            escaped = true;
+            if( ++m_p == m_end ) {
+               invalid();
+            }
+            end = m_p + 1;
+         }
+         else if( ( *m_p == '{' ) || ( *m_p == '"' ) ) {
+            invalid();
+         }
+         else if( !( ( *m_p == ' ' ) || ( ( *m_p >= '\t' ) && ( *m_p <= '\r' ) ) ) ) {
+            end = m_p + 1;
+         }
+         ++m_p;
+      }
+      const auto size = static_cast< std::size_t >( end - begin );
+      if( !escaped ) {
+         if( ( size == 4 ) && ( ( begin[ 0 ] | 0x20 ) == 'n' ) && ( ( begin[ 1 ] | 0x20 ) == 'u' ) && ( ( begin[ 2 ] | 0x20 ) == 'l' ) && ( ( begin[ 3 ] | 0x20 ) == 'l' ) ) {
+            return { nullptr, 0, false };
+         }
+         return { begin, size, false };
+      }
+      scratch.clear();
+      for( const char* p = begin; p != end; ++p ) {
+         if( *p == '\\' ) {
+            ++p;
+         }
+         scratch += *p;
+      }
+      return { scratch.c_str(), scratch.size(), true };
+   }
+
+   void array_text_parser::finish()
+   {
+      skip_whitespace();
+      if( m_p != m_end ) {
+         invalid();
+      }
+   }
+
+   array_binary_reader::array_binary_reader( const char* value, const std::size_t size )
+      : m_p( value ),
+        m_end( value + size ),
+        m_dimensions( 0 ),
+        m_element_type( 0 ),
+        m_sizes()
+   {
+      if( size < 12 ) {
+         throw std::runtime_error( internal::printf( "invalid size in tao::pq::result_binary_traits for array of %zu bytes", size ) );
+      }
+      const std::int32_t dimensions = get_int32( m_p );
+      if( ( dimensions < 0 ) || ( dimensions > 6 ) || ( size < 12 + 8 * static_cast< std::size_t >( dimensions ) ) ) {
+         throw std::runtime_error( internal::printf( "invalid array in tao::pq::result_binary_traits with %d dimensions", int( dimensions ) ) );
+      }
+      const std::int32_t has_null = get_int32( m_p + 4 );
+      if( ( has_null != 0 ) && ( has_null != 1 ) ) {
+         throw std::runtime_error( internal::printf( "invalid array in tao::pq::result_binary_traits with null flag %d", int( has_null ) ) );
+      }
+      m_dimensions = static_cast< std::size_t >( dimensions );
+      m_element_type = static_cast< Oid >( static_cast< std::uint32_t >( get_int32( m_p + 8 ) ) );
+      m_p += 12 + 8 * m_dimensions;
+
+      // every element takes at least 4 bytes, which limits the sizes before they are used to reserve space
+      const auto available = static_cast< std::size_t >( m_end - m_p ) / 4;
+      std::size_t elements = 1;
+      for( std::size_t i = 0; i < m_dimensions; ++i ) {
+         const std::int32_t n = get_int32( value + 12 + 8 * i );  // the lower bound is ignored
+         if( n < 0 ) {
+            throw std::runtime_error( internal::printf( "invalid array in tao::pq::result_binary_traits with a dimension of size %d", int( n ) ) );
+         }
+         m_sizes[ i ] = static_cast< std::size_t >( n );
+         if( ( n != 0 ) && ( elements > available / m_sizes[ i ] ) ) {
+            throw std::runtime_error( internal::printf( "invalid array in tao::pq::result_binary_traits with a dimension of size %d for %zu bytes", int( n ), size ) );
+         }
+         elements *= m_sizes[ i ];
+      }
+   }
+
+   auto array_binary_reader::element() -> array_element
+   {
+      if( m_end - m_p < 4 ) {
+         throw std::runtime_error( "invalid array in tao::pq::result_binary_traits: unexpected end of data" );
+      }
+      const std::int32_t n = get_int32( m_p );
+      m_p += 4;
+      if( n == -1 ) {
+         return { nullptr, 0, false };
+      }
+      if( ( n < 0 ) || ( m_end - m_p < n ) ) {
+         throw std::runtime_error( "invalid array in tao::pq::result_binary_traits: unexpected end of data" );
+      }
+      const char* const begin = m_p;
+      m_p += n;
+      return { begin, static_cast< std::size_t >( n ), false };
+   }
+
+   void array_binary_reader::finish() const
+   {
+      if( m_p != m_end ) {
+         throw std::runtime_error( "invalid array in tao::pq::result_binary_traits: unexpected data after the last element" );
+      }
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,370 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/internal/chrono.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <tao/pq/internal/endian.hpp>
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq::internal
+{
+   namespace
+   {
+      constexpr std::int64_t microseconds_per_second = 1000000;
+      constexpr std::int64_t microseconds_per_day = 86400 * microseconds_per_second;
+
+      // proleptic Gregorian calendar, see http://howardhinnant.github.io/date_algorithms.html
+      [[nodiscard]] auto days_from_civil( std::int64_t y, const unsigned m, const unsigned d ) noexcept -> std::int64_t
+      {
+         y -= ( m <= 2 ) ? 1 : 0;
+         const std::int64_t era = ( ( y >= 0 ) ? y : ( y - 399 ) ) / 400;
+         const auto yoe = static_cast< unsigned >( y - era * 400 );
+         const unsigned doy = ( 153 * ( ( m > 2 ) ? ( m - 3 ) : ( m + 9 ) ) + 2 ) / 5 + d - 1;
+         const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+         return era * 146097 + static_cast< std::int64_t >( doe ) - 719468;
+      }
+
+      struct civil
+      {
+         std::int64_t y;
+         unsigned m;
+         unsigned d;
+      };
+
+      [[nodiscard]] auto civil_from_days( std::int64_t z ) noexcept -> civil
+      {
+         z += 719468;
+         const std::int64_t era = ( ( z >= 0 ) ? z : ( z - 146096 ) ) / 146097;
+         const auto doe = static_cast< unsigned >( z - era * 146097 );
+         const unsigned yoe = ( doe - doe / 1460 + doe / 36524 - doe / 146096 ) / 365;
+         const unsigned doy = doe - ( 365 * yoe + yoe / 4 - yoe / 100 );
+         const unsigned mp = ( 5 * doy + 2 ) / 153;
+         const unsigned d = doy - ( 153 * mp + 2 ) / 5 + 1;
+         const unsigned m = ( mp < 10 ) ? ( mp + 3 ) : ( mp - 9 );
+         return { static_cast< std::int64_t >( yoe ) + era * 400 + ( ( m <= 2 ) ? 1 : 0 ), m, d };
+      }
+
+      [[nodiscard]] auto floor_div( const std::int64_t a, const std::int64_t b ) noexcept -> std::int64_t
+      {
+         const std::int64_t q = a / b;
+         return ( ( a % b ) < 0 ) ? ( q - 1 ) : q;
+      }
+
+      // writes the date, the year 0 and before are written as the years 1 BC and before
+      auto format_civil( char* buffer, const civil c, const char*& era ) noexcept -> int
+      {
+         era = ( c.y <= 0 ) ? " BC" : "";
+         return std::snprintf( buffer, chrono_buffer_size, "%04lld-%02u-%02u", static_cast< long long >( ( c.y <= 0 ) ? ( 1 - c.y ) : c.y ), c.m, c.d );
+      }
+
+      [[nodiscard]] auto invalid( const char* type, const char* value ) -> std::runtime_error
+      {
+         return std::runtime_error( internal::printf( "invalid %s in tao::pq for input: %s", type, value ) );
+      }
+
+      class parser
+      {
+      private:
+         const char* const m_value;
+         const char* m_p;
+         const char* const m_type;
+
+      public:
+         parser( const char* value, const char* type ) noexcept
+            : m_value( value ),
+              m_p( value ),
+              m_type( type )
+         {}
+
+         [[nodiscard]] auto error() const -> std::runtime_error
+         {
+            return invalid( m_type, m_value );
+         }
+
+         [[nodiscard]] auto peek() const noexcept -> char
+         {
+            return *m_p;
+         }
+
+         [[nodiscard]] auto peek_digit( const std::size_t offset = 0 ) const noexcept -> bool
+         {
+            for( std::size_t i = 0; i < offset; ++i ) {
+               if( m_p[ i ] == '\0' ) {
+                  return false;
+               }
+            }
+            return ( m_p[ offset ] >= '0' ) && ( m_p[ offset ] <= '9' );
+         }
+
+         [[nodiscard]] auto accept( const char c ) noexcept -> bool
+         {
+            if( *m_p == c ) {
+               ++m_p;
+               return true;
+            }
+            return false;
+         }
+
+         [[nodiscard]] auto accept( const char* s ) noexcept -> bool
+         {
+            const std::size_t n = std::strlen( s );
+            if( std::strncmp( m_p, s, n ) == 0 ) {
+               m_p += n;
+               return true;
+            }
+            return false;
+         }
+
+         void expect( const char c )
+         {
+            if( !accept( c ) ) {
+               throw error();
+            }
+         }
+
+         // between min and max digits, which is at most 18 to rule out overflows
+         [[nodiscard]] auto digits( const std::size_t min, const std::size_t max ) -> std::int64_t
+         {
+            std::int64_t nrv = 0;
+            std::size_t n = 0;
+            while( ( n < max ) && peek_digit() ) {
+               nrv = nrv * 10 + ( *m_p++ - '0' );
+               ++n;
+            }
+            if( ( n < min ) || peek_digit() ) {
+               throw error();
+            }
+            return nrv;
+         }
+
+         // hours, minutes, seconds and the optional fraction in microseconds
+         [[nodiscard]] auto time( const std::size_t hour_digits ) -> std::int64_t
+         {
+            const std::int64_t h = digits( 1, hour_digits );
+            expect( ':' );
+            const std::int64_t m = digits( 2, 2 );
+            expect( ':' );
+            const std::int64_t s = digits( 2, 2 );
+            if( ( m > 59 ) || ( s > 60 ) ) {
+               throw error();
+            }
+            std::int64_t f = 0;
+            if( accept( '.' ) ) {
+               std::int64_t scale = microseconds_per_second;
+               while( peek_digit() ) {
+                  scale /= 10;
+                  f += ( *m_p++ - '0' ) * scale;
+               }
+            }
+            return ( ( h * 60 + m ) * 60 + s ) * microseconds_per_second + f;
+         }
+
+         [[nodiscard]] auto at_end() const noexcept -> bool
+         {
+            return *m_p == '\0';
+         }
+      };
+
+      template< typename T >
+      [[nodiscard]] auto ntoh( const char* value ) noexcept -> T
+      {
+         T v;
+         std::memcpy( &v, value, sizeof( T ) );
+         return internal::hton( v );
+      }
+
+      [[nodiscard]] auto checked_add( const std::int64_t a, const std::int64_t b, const char* type ) -> std::int64_t
+      {
+         if( ( b > 0 ) ? ( a > std::numeric_limits< std::int64_t >::max() - b ) : ( a < std::numeric_limits< std::int64_t >::min() - b ) ) {
+            throw chrono_overflow( type );
+         }
+         return a + b;
+      }
+
+      [[nodiscard]] auto days_to_microseconds( const std::int64_t days, const char* type ) -> std::int64_t
+      {
+         if( ( days > std::numeric_limits< std::int64_t >::max() / microseconds_per_day ) || ( days < std::numeric_limits< std::int64_t >::min() / microseconds_per_day ) ) {
+            throw chrono_overflow( type );
+         }
+         return days * microseconds_per_day;
+      }
+
+   }  // namespace
+
+   auto chrono_overflow( const char* type ) -> std::overflow_error
+   {
+      return std::overflow_error( internal::printf( "overflow error in tao::pq conversion of %s", type ) );
+   }
+
+   auto format_date( char* buffer, const std::int64_t days ) noexcept -> std::size_t
+   {
+      const char* era;
+      const int n = format_civil( buffer, civil_from_days( days + postgres_epoch_days ), era );
+      return static_cast< std::size_t >( n + std::snprintf( buffer + n, chrono_buffer_size - n, "%s", era ) );
+   }
+
+   auto format_timestamp( char* buffer, const std::int64_t microseconds ) noexcept -> std::size_t
+   {
+      const std::int64_t days = floor_div( microseconds, microseconds_per_day );
+      const std::int64_t time = microseconds - days * microseconds_per_day;
+      const std::int64_t seconds = time / microseconds_per_second;
+      const char* era;
+      const int n = format_civil( buffer, civil_from_days( days + postgres_epoch_days ), era );
+      return static_cast< std::size_t >( n + std::snprintf( buffer + n, chrono_buffer_size - n, " %02d:%02d:%02d.%06d+00%s", static_cast< int >( seconds / 3600 ), static_cast< int >( seconds / 60 % 60 ), static_cast< int >( seconds % 60 ), static_cast< int >( time % microseconds_per_second ), era ) );
+   }
+
+   auto format_interval( char* buffer, const std::int64_t microseconds ) noexcept -> std::size_t
+   {
+      const bool negative = microseconds < 0;
+      const auto magnitude = negative ? ( 0 - static_cast< std::uint64_t >( microseconds ) ) : static_cast< std::uint64_t >( microseconds );
+      const std::uint64_t seconds = magnitude / microseconds_per_second;
+      return static_cast< std::size_t >( std::snprintf( buffer, chrono_buffer_size, "%s%llu:%02u:%02u.%06u", negative ? "-" : "", static_cast< unsigned long long >( seconds / 3600 ), static_cast< unsigned >( seconds / 60 % 60 ), static_cast< unsigned >( seconds % 60 ), static_cast< unsigned >( magnitude % microseconds_per_second ) ) );
+   }
+
+   auto parse_timestamp( const char* value ) -> std::int64_t
+   {
+      parser p( value, "timestamp" );
+      std::int64_t y = p.digits( 4, 6 );
+      p.expect( '-' );
+      const auto m = static_cast< unsigned >( p.digits( 2, 2 ) );
+      p.expect( '-' );
+      const auto d = static_cast< unsigned >( p.digits( 2, 2 ) );
+
+      std::int64_t time = 0;
+      if( ( p.peek() == ' ' || p.peek() == 'T' ) && p.peek_digit( 1 ) ) {
+         (void)p.accept( p.peek() );
+         time = p.time( 2 );
+         if( time > microseconds_per_day ) {
+            throw p.error();
+         }
+      }
+      if( ( p.peek() == '+' ) || ( p.peek() == '-' ) ) {
+         const bool negative = ( p.peek() == '-' );
+         (void)p.accept( p.peek() );
+         std::int64_t offset = p.digits( 2, 2 ) * 3600;
+         if( p.accept( ':' ) ) {
+            offset += p.digits( 2, 2 ) * 60;
+            if( p.accept( ':' ) ) {
+               offset += p.digits( 2, 2 );
+            }
+         }
+         time -= ( negative ? -offset : offset ) * microseconds_per_second;
+      }
+      if( p.accept( " BC" ) ) {
+         y = 1 - y;
+      }
+      if( !p.at_end() || ( m < 1 ) || ( m > 12 ) || ( d < 1 ) ) {
+         throw p.error();
+      }
+      const std::int64_t days = days_from_civil( y, m, d );
+      const civil c = civil_from_days( days );
+      if( c.d != d ) {
+         throw p.error();
+      }
+      return checked_add( days_to_microseconds( days - postgres_epoch_days, "timestamp" ), time, "timestamp" );
+   }
+
+   auto parse_interval( const char* value ) -> std::int64_t
+   {
+      parser p( value, "interval" );
+      std::int64_t nrv = 0;
+      bool any = false;
+      while( !p.at_end() ) {
+         if( any ) {
+            p.expect( ' ' );
+         }
+         any = true;
+         const bool negative = p.accept( '-' );
+         if( !negative ) {
+            (void)p.accept( '+' );
+         }
+         if( p.peek_digit() ) {
+            // the hours of a time may have more than two digits
+            parser lookahead = p;
+            (void)lookahead.digits( 1, 18 );
+            if( lookahead.peek() == ':' ) {
+               const std::int64_t time = p.time( 18 );
+               nrv = checked_add( nrv, negative ? -time : time, "interval" );
+               continue;
+            }
+         }
+         const std::int64_t n = p.digits( 1, 18 );
+         p.expect( ' ' );
+         if( p.accept( "days" ) || p.accept( "day" ) ) {
+            nrv = checked_add( nrv, days_to_microseconds( negative ? -n : n, "interval" ), "interval" );
+         }
+         else if( p.accept( "year" ) || p.accept( "mon" ) ) {
+            throw std::runtime_error( internal::printf( "interval with years or months can not be converted to a std::chrono::duration: %s", value ) );
+         }
+         else {
+            throw p.error();
+         }
+      }
+      if( !any ) {
+         throw p.error();
+      }
+      return nrv;
+   }
+
+   auto decode_timestamp( const char* value, const std::size_t size, const Oid type ) -> std::int64_t
+   {
+      switch( type ) {
+         case 1082: {  // date
+            if( size != 4 ) {
+               break;
+            }
+            const auto days = ntoh< std::int32_t >( value );
+            if( ( days == std::numeric_limits< std::int32_t >::max() ) || ( days == std::numeric_limits< std::int32_t >::min() ) ) {
+               throw std::runtime_error( "infinite date can not be converted to a std::chrono::time_point" );
+            }
+            return days_to_microseconds( days, "date" );
+         }
+
+         case 1114:  // timestamp
+         case 1184: {  // timestamptz
+            if( size != 8 ) {
+               break;
+            }
+            const auto microseconds = ntoh< std::int64_t >( value );
+            if( ( microseconds == std::numeric_limits< std::int64_t >::max() ) || ( microseconds == std::numeric_limits< std::int64_t >::min() ) ) {
+               throw std::runtime_error( "infinite timestamp can not be converted to a std::chrono::time_point" );
+            }
+            return microseconds;
+         }
+
+         default:
+            throw std::runtime_error( internal::printf( "invalid type in tao::pq::result_binary_traits<std::chrono::time_point> for input of type oid %u", unsigned( type ) ) );
+      }
+      throw std::runtime_error( internal::printf( "invalid size in tao::pq::result_binary_traits<std::chrono::time_point> for input of %zu bytes", size ) );
+   }
+
+   auto decode_interval( const char* value, const std::size_t size, const Oid type ) -> std::int64_t
+   {
+      switch( type ) {
+         case 1083:  // time
+            if( size != 8 ) {
+               break;
+            }
+            return ntoh< std::int64_t >( value );
+
+         case 1186:  // interval
+            if( size != 16 ) {
+               break;
+            }
+            if( ntoh< std::int32_t >( value + 12 ) != 0 ) {
+               throw std::runtime_error( "interval with years or months can not be converted to a std::chrono::duration" );
+            }
+            return checked_add( ntoh< std::int64_t >( value ), days_to_microseconds( ntoh< std::int32_t >( value + 8 ), "interval" ), "interval" );
+
+         default:
+            throw std::runtime_error( internal::printf( "invalid type in tao::pq::result_binary_traits<std::chrono::duration> for input of type oid %u", unsigned( type ) ) );
+      }
+      throw std::runtime_error( internal::printf( "invalid size in tao::pq::result_binary_traits<std::chrono::duration> for input of %zu bytes", size ) );
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,105 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/internal/column_index.hpp>
+
+#include <cctype>
+#include <string>
+
+namespace tao::pq::internal
+{
+   namespace
+   {
+      // same as libpq's pg_tolower()
+      [[nodiscard]] auto fold( const char c ) noexcept -> char
+      {
+         const auto u = static_cast< unsigned char >( c );
+         if( ( u >= 'A' ) && ( u <= 'Z' ) ) {
+            return static_cast< char >( u + ( 'a' - 'A' ) );
+         }
+         if( ( u >= 0x80 ) && ( std::isupper( u ) != 0 ) ) {
+            return static_cast< char >( std::tolower( u ) );
+         }
+         return c;
+      }
+
+      // whether the name is matched as-is, which is the common case and avoids an allocation
+      [[nodiscard]] auto is_verbatim( const std::string_view name ) noexcept -> bool
+      {
+         for( const char c : name ) {
+            if( ( c == '"' ) || ( fold( c ) != c ) ) {
+               return false;
+            }
+         }
+         return true;
+      }
+
+      [[nodiscard]] auto normalize( const std::string_view name ) -> std::string
+      {
+         std::string nrv;
+         nrv.reserve( name.size() );
+         bool in_quotes = false;
+         for( std::size_t i = 0; i < name.size(); ++i ) {
+            const char c = name[ i ];
+            if( in_quotes ) {
+               if( c == '"' ) {
+                  if( ( i + 1 < name.size() ) && ( name[ i + 1 ] == '"' ) ) {
+                     nrv += '"';
+                     ++i;
+                  }
+                  else {
+                     in_quotes = false;
+                  }
+               }
+               else {
+                  nrv += c;
+               }
+            }
+            else if( c == '"' ) {
+               in_quotes = true;
+            }
+            else {
+               nrv += fold( c );
+            }
+         }
+         return nrv;
+      }
+
+   }  // namespace
+
+   void column_index::build()
+   {
+      const auto columns = m_snapshot ? m_snapshot->columns() : static_cast< std::size_t >( PQnfields( m_pgresult.get() ) );
+      m_first.reserve( columns );
+      m_next.assign( columns, npos );
+      std::unordered_map< std::string_view, std::size_t > last;
+      for( std::size_t column = 0; column < columns; ++column ) {
+         const std::string_view name = m_snapshot ? m_snapshot->name( column ) : PQfname( m_pgresult.get(), static_cast< int >( column ) );
+         const auto [ it, inserted ] = m_first.try_emplace( name, column );
+         if( !inserted ) {
+            const auto jt = last.try_emplace( name, it->second ).first;
+            m_next[ jt->second ] = column;
+            jt->second = column;
+         }
+      }
+   }
+
+   auto column_index::find( const char* name, const std::size_t offset ) -> std::size_t
+   {
+      std::call_once( m_once, [ this ] { build(); } );
+      const std::string_view sv = name;
+      if( sv.empty() ) {
+         return npos;
+      }
+      const auto it = is_verbatim( sv ) ? m_first.find( sv ) : m_first.find( normalize( sv ) );
+      if( it == m_first.end() ) {
+         return npos;
+      }
+      std::size_t column = it->second;
+      while( ( column != npos ) && ( column < offset ) ) {
+         column = m_next[ column ];
+      }
+      return column;
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,150 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/internal/numeric.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include <tao/pq/internal/parameter_binary_traits.hpp>
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq::internal
+{
+   namespace
+   {
+      constexpr std::uint16_t numeric_positive = 0x0000;
+      constexpr std::uint16_t numeric_negative = 0x4000;
+      constexpr std::uint16_t numeric_nan = 0xC000;
+
+      void put( char* buffer, const std::uint16_t v ) noexcept
+      {
+         buffer[ 0 ] = static_cast< char >( v >> 8 );
+         buffer[ 1 ] = static_cast< char >( v & 0xFF );
+      }
+
+      [[nodiscard]] auto get( const char* buffer ) noexcept -> std::uint16_t
+      {
+         return static_cast< std::uint16_t >( ( static_cast< unsigned char >( buffer[ 0 ] ) << 8 ) | static_cast< unsigned char >( buffer[ 1 ] ) );
+      }
+
+      [[nodiscard]] auto overflow() -> std::overflow_error
+      {
+         return std::overflow_error( "overflow error in tao::pq::decimal for binary numeric input" );
+      }
+
+   }  // namespace
+
+   auto magnitude_digits( char* buffer, decimal::unsigned_coefficient_type magnitude ) noexcept -> std::string_view
+   {
+      char* p = buffer + magnitude_buffer_size;
+      while( magnitude != 0 ) {
+         *--p = static_cast< char >( '0' + static_cast< int >( magnitude % 10 ) );
+         magnitude /= 10;
+      }
+      return std::string_view( p, static_cast< std::size_t >( buffer + magnitude_buffer_size - p ) );
+   }
+
+   auto encode_numeric( char* buffer, std::string_view digits, const std::size_t scale, const bool negative ) noexcept -> std::size_t
+   {
+      while( !digits.empty() && ( digits.front() == '0' ) ) {
+         digits.remove_prefix( 1 );
+      }
+      // pad the digits on the left so the base 10000 digits are aligned to the decimal point
+      const auto integral = static_cast< long long >( digits.size() ) - static_cast< long long >( scale );
+      const long long pad = ( 4 - ( ( integral % 4 ) + 4 ) % 4 ) % 4;
+      const long long weight = ( integral + pad ) / 4 - 1;
+
+      std::size_t ndigits = 0;
+      std::size_t nonzero = 0;
+      for( long long i = -pad; i < static_cast< long long >( digits.size() ); i += 4 ) {
+         unsigned v = 0;
+         for( long long j = i; j < i + 4; ++j ) {
+            v = v * 10 + ( ( ( j >= 0 ) && ( j < static_cast< long long >( digits.size() ) ) ) ? static_cast< unsigned >( digits[ j ] - '0' ) : 0 );
+         }
+         put( buffer + 8 + 2 * ndigits++, static_cast< std::uint16_t >( v ) );
+         if( v != 0 ) {
+            nonzero = ndigits;
+         }
+      }
+      // trailing zero digits are implied by dscale
+      ndigits = nonzero;
+      put( buffer, static_cast< std::uint16_t >( ndigits ) );
+      put( buffer + 2, static_cast< std::uint16_t >( ( ndigits == 0 ) ? 0 : weight ) );
+      put( buffer + 4, ( negative && ( ndigits != 0 ) ) ? numeric_negative : numeric_positive );
+      put( buffer + 6, static_cast< std::uint16_t >( scale ) );
+      return 8 + 2 * ndigits;
+   }
+
+   auto decode_numeric( const char* value, const std::size_t size ) -> decimal
+   {
+      if( size < 8 ) {
+         throw std::runtime_error( internal::printf( "invalid size in tao::pq::result_binary_traits<tao::pq::decimal> for input of %zu bytes", size ) );
+      }
+      const std::size_t ndigits = get( value );
+      const auto weight = static_cast< std::int16_t >( get( value + 2 ) );
+      const std::uint16_t sign = get( value + 4 );
+      const int dscale = get( value + 6 );
+      if( size != 8 + 2 * ndigits ) {
+         throw std::runtime_error( internal::printf( "invalid size in tao::pq::result_binary_traits<tao::pq::decimal> for input of %zu bytes", size ) );
+      }
+      if( sign == numeric_nan ) {
+         throw std::runtime_error( "tao::pq::decimal does not support NaN" );
+      }
+      if( ( sign != numeric_positive ) && ( sign != numeric_negative ) ) {
+         throw std::runtime_error( "tao::pq::decimal does not support infinity" );
+      }
+      if( dscale > decimal::max_scale ) {
+         throw std::runtime_error( internal::printf( "invalid scale in tao::pq::result_binary_traits<tao::pq::decimal>: %d", dscale ) );
+      }
+
+      using magnitude_t = decimal::unsigned_coefficient_type;
+      magnitude_t magnitude = 0;
+      for( std::size_t i = 0; i < ndigits; ++i ) {
+         const std::uint16_t digit = get( value + 8 + 2 * i );
+         if( digit > 9999 ) {
+            throw std::runtime_error( internal::printf( "invalid digit in tao::pq::result_binary_traits<tao::pq::decimal>: %u", unsigned( digit ) ) );
+         }
+         if( magnitude > ( decimal::max_magnitude - digit ) / 10000 ) {
+            throw overflow();
+         }
+         magnitude = magnitude * 10000 + digit;
+      }
+      // the last digit is in units of 10^exponent, the coefficient is in units of 10^-dscale
+      if( ndigits != 0 ) {
+         long long exponent = 4 * ( static_cast< long long >( weight ) - static_cast< long long >( ndigits ) + 1 ) + dscale;
+         for( ; exponent > 0; --exponent ) {
+            if( magnitude > decimal::max_magnitude / 10 ) {
+               throw overflow();
+            }
+            magnitude *= 10;
+         }
+         for( ; exponent < 0; ++exponent ) {
+            if( magnitude % 10 != 0 ) {
+               throw std::runtime_error( "invalid value in tao::pq::result_binary_traits<tao::pq::decimal>: digits beyond the scale" );
+            }
+            magnitude /= 10;
+         }
+      }
+      const auto coefficient = static_cast< decimal::coefficient_type >( magnitude );
+      return decimal{ ( sign == numeric_negative ) ? -coefficient : coefficient, dscale };
+   }
+
+   numeric_helper::numeric_helper( const unsigned long long v ) noexcept
+   {
+      char buffer[ magnitude_buffer_size ];
+      m_size = static_cast< int >( encode_numeric( m_buffer, magnitude_digits( buffer, v ), 0, false ) );
+   }
+
+   numeric_helper::numeric_helper( const decimal& v )
+   {
+      if( ( v.scale < 0 ) || ( v.scale > decimal::max_scale ) ) {
+         throw std::out_of_range( internal::printf( "invalid scale in tao::pq::decimal: %d", v.scale ) );
+      }
+      const bool negative = v.coefficient < 0;
+      const auto magnitude = negative ? ( decimal::unsigned_coefficient_type( 0 ) - static_cast< decimal::unsigned_coefficient_type >( v.coefficient ) ) : static_cast< decimal::unsigned_coefficient_type >( v.coefficient );
+      char buffer[ magnitude_buffer_size ];
+      m_size = static_cast< int >( encode_numeric( m_buffer, magnitude_digits( buffer, magnitude ), static_cast< std::size_t >( v.scale ), negative ) );
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,87 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined( _WIN32 )
+#include <winsock2.h>
+#else
+#include <poll.h>
+#endif
+
+#include <tao/pq/internal/poll.hpp>
+
+namespace tao::pq::internal
+{
+   auto poll( const int socket, const poll_status status, const int timeout ) -> bool
+   {
+      if( status == poll_status::ready ) {
+         return true;
+      }
+      pollfd pfd = {};
+      pfd.fd = socket;
+      pfd.events = ( status == poll_status::wait_writable ) ? POLLOUT : POLLIN;
+      while( true ) {
+#if defined( _WIN32 )
+         const int r = ::WSAPoll( &pfd, 1, timeout );
+         if( r < 0 ) {
+            throw std::runtime_error( "WSAPoll() failed with error " + std::to_string( ::WSAGetLastError() ) );  // LCOV_EXCL_LINE
+         }
+#else
+         const int r = ::poll( &pfd, 1, timeout );
+         if( r < 0 ) {
+            if( errno == EINTR ) {
+               continue;  // LCOV_EXCL_LINE
+            }
+            throw std::runtime_error( std::string( "poll() failed: " ) + std::strerror( errno ) );  // LCOV_EXCL_LINE
+         }
+#endif
+         return r != 0;
+      }
+   }
+
+   auto poll( std::vector< poll_request >& requests, const int timeout ) -> bool
+   {
+      std::vector< pollfd > pfds;
+      pfds.reserve( requests.size() );
+      bool ready = false;
+      for( auto& request : requests ) {
+         request.ready = ( request.status == poll_status::ready );
+         ready = ready || request.ready;
+         pollfd pfd = {};
+         pfd.fd = request.socket;
+         pfd.events = ( request.status == poll_status::wait_writable ) ? POLLOUT : POLLIN;
+         pfds.push_back( pfd );
+      }
+      if( ready || requests.empty() ) {
+         return ready;
+      }
+      while( true ) {
+#if defined( _WIN32 )
+         const int r = ::WSAPoll( pfds.data(), static_cast< ULONG >( pfds.size() ), timeout );
+         if( r < 0 ) {
+            throw std::runtime_error( "WSAPoll() failed with error " + std::to_string( ::WSAGetLastError() ) );  // LCOV_EXCL_LINE
+         }
+#else
+         const int r = ::poll( pfds.data(), static_cast< nfds_t >( pfds.size() ), timeout );
+         if( r < 0 ) {
+            if( errno == EINTR ) {
+               continue;  // LCOV_EXCL_LINE
+            }
+            throw std::runtime_error( std::string( "poll() failed: " ) + std::strerror( errno ) );  // LCOV_EXCL_LINE
+         }
+#endif
+         for( std::size_t i = 0; i < pfds.size(); ++i ) {
+            // errors and hang-ups count as ready, the next PQconnectPoll() reports them
+            requests[ i ].ready = ( pfds[ i ].revents != 0 );
+         }
+         return r != 0;
+      }
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,72 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <tao/pq/internal/prepared_cache.hpp>
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq::internal
+{
+   prepared_cache::prepared_cache( const std::size_t capacity, const std::size_t threshold )
+      : m_capacity( capacity ),
+        m_threshold( threshold )
+   {
+      if( capacity == 0 ) {
+         throw std::invalid_argument( "invalid capacity 0" );
+      }
+      if( threshold == 0 ) {
+         throw std::invalid_argument( "invalid threshold 0" );
+      }
+      m_index.reserve( capacity + 1 );
+   }
+
+   auto prepared_cache::use( const std::string_view key, const int n_params, const Oid types[], std::vector< std::string >& evicted ) -> entry&
+   {
+      const auto it = m_index.find( key );
+      if( it != m_index.end() ) {
+         m_entries.splice( m_entries.begin(), m_entries, it->second );
+         entry& e = m_entries.front();
+         if( !std::equal( e.types.begin(), e.types.end(), types, types + n_params ) ) {
+            if( !e.name.empty() ) {
+               evicted.emplace_back( std::move( e.name ) );
+               e.name.clear();
+            }
+            e.types.assign( types, types + n_params );
+            e.count = 0;
+         }
+         return e;
+      }
+      m_entries.push_front( entry{ std::string( key ), std::vector< Oid >( types, types + n_params ), 0, std::string() } );
+      m_index.emplace( m_entries.front().key, m_entries.begin() );
+      while( m_entries.size() > m_capacity ) {
+         entry& e = m_entries.back();
+         if( !e.name.empty() ) {
+            evicted.emplace_back( std::move( e.name ) );
+         }
+         m_index.erase( e.key );
+         m_entries.pop_back();
+      }
+      return m_entries.front();
+   }
+
+   auto prepared_cache::next_name() -> std::string
+   {
+      return internal::printf( "taopq_auto_%zu", m_next_id++ );
+   }
+
+   auto prepared_cache::clear() -> std::vector< std::string >
+   {
+      std::vector< std::string > nrv;
+      for( auto& e : m_entries ) {
+         if( !e.name.empty() ) {
+            nrv.emplace_back( std::move( e.name ) );
+         }
+      }
+      m_index.clear();
+      m_entries.clear();
+      return nrv;
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,161 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/internal/snapshot.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq::internal
+{
+   namespace
+   {
+      constexpr char magic[ 8 ] = { 'T', 'A', 'O', 'P', 'Q', 'S', 'N', 'P' };
+      constexpr std::uint32_t byte_order_mark = 0x01020304;
+      constexpr std::uint32_t version = 1;
+
+      [[nodiscard]] auto padded( const std::size_t size ) noexcept -> std::size_t
+      {
+         return ( size + 7 ) & ~std::size_t( 7 );
+      }
+
+      template< typename T >
+      void store( std::string& data, const std::size_t pos, const T value ) noexcept
+      {
+         std::memcpy( &data[ pos ], &value, sizeof( value ) );
+      }
+
+      template< typename T >
+      [[nodiscard]] auto read( const char* data ) noexcept -> T
+      {
+         T nrv;
+         std::memcpy( &nrv, data, sizeof( nrv ) );
+         return nrv;
+      }
+
+      [[nodiscard]] auto invalid( const char* reason ) -> std::runtime_error
+      {
+         return std::runtime_error( internal::printf( "invalid result snapshot: %s", reason ) );
+      }
+
+   }  // namespace
+
+   snapshot::snapshot( std::shared_ptr< const void > owner, const char* data, const std::size_t size )
+      : m_owner( std::move( owner ) ),
+        m_data( data ),
+        m_size( size )
+   {
+      if( ( m_size < header_size ) || ( std::memcmp( m_data, magic, sizeof( magic ) ) != 0 ) ) {
+         throw invalid( "missing header" );
+      }
+      if( read< std::uint32_t >( m_data + 8 ) != byte_order_mark ) {
+         throw invalid( "byte order mismatch" );
+      }
+      if( read< std::uint32_t >( m_data + 12 ) != version ) {
+         throw invalid( "unsupported version" );
+      }
+      const std::uint64_t columns = read< std::uint64_t >( m_data + 16 );
+      const std::uint64_t rows = read< std::uint64_t >( m_data + 24 );
+      const std::uint64_t values_size = read< std::uint64_t >( m_data + 32 );
+
+      // bound each factor by the size first to rule out overflows, a result without columns may still have any number of rows
+      const std::size_t limit = m_size / sizeof( std::uint64_t );
+      if( ( columns > limit ) || ( ( columns != 0 ) && ( rows > limit / columns ) ) || ( values_size > m_size ) ) {
+         throw invalid( "size mismatch" );
+      }
+      m_columns = static_cast< std::size_t >( columns );
+      m_rows = static_cast< std::size_t >( rows );
+      const std::size_t fields = m_rows * m_columns;
+
+      const std::size_t offsets = header_size + m_columns * column_size;
+      const std::size_t nulls = offsets + ( fields + 1 ) * sizeof( std::uint64_t );
+      const std::size_t values = nulls + padded( ( fields + 7 ) / 8 );
+      if( ( values_size == 0 ) || ( values + values_size != m_size ) || ( m_data[ m_size - 1 ] != '\0' ) ) {
+         throw invalid( "size mismatch" );
+      }
+      m_column_table = m_data + header_size;
+      m_offsets = m_data + offsets;
+      m_nulls = reinterpret_cast< const unsigned char* >( m_data + nulls );
+      m_values = m_data + values;
+
+      for( std::size_t column = 0; column < m_columns; ++column ) {
+         if( read< std::uint64_t >( m_column_table + column * column_size ) >= values_size ) {
+            throw invalid( "column name out of range" );
+         }
+      }
+      // the last byte of the value area is zero, so every value which is in range is also terminated
+      std::size_t previous = offset( 0 );
+      for( std::size_t i = 1; i <= fields; ++i ) {
+         const std::size_t next = offset( i );
+         if( next <= previous ) {
+            throw invalid( "offsets not ascending" );
+         }
+         previous = next;
+      }
+      if( previous != values_size ) {
+         throw invalid( "offsets out of range" );
+      }
+   }
+
+   auto snapshot::serialize( const PGresult* pgresult ) -> std::string
+   {
+      const auto columns = static_cast< std::size_t >( PQnfields( pgresult ) );
+      const auto rows = static_cast< std::size_t >( PQntuples( pgresult ) );
+      const std::size_t fields = rows * columns;
+
+      // PQcmdTuples() is not const-correct, but does not modify the result
+      const std::string_view cmd_tuples = PQcmdTuples( const_cast< PGresult* >( pgresult ) );  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+      std::size_t values_size = cmd_tuples.size() + 1;
+      for( std::size_t column = 0; column < columns; ++column ) {
+         values_size += std::strlen( PQfname( pgresult, static_cast< int >( column ) ) ) + 1;
+      }
+      for( std::size_t row = 0; row < rows; ++row ) {
+         for( std::size_t column = 0; column < columns; ++column ) {
+            values_size += static_cast< std::size_t >( PQgetlength( pgresult, static_cast< int >( row ), static_cast< int >( column ) ) ) + 1;
+         }
+      }
+
+      const std::size_t column_table = header_size;
+      const std::size_t offsets = column_table + columns * column_size;
+      const std::size_t nulls = offsets + ( fields + 1 ) * sizeof( std::uint64_t );
+      const std::size_t values = nulls + padded( ( fields + 7 ) / 8 );
+
+      std::string nrv( values + values_size, '\0' );
+      std::memcpy( &nrv[ 0 ], magic, sizeof( magic ) );
+      store( nrv, 8, byte_order_mark );
+      store( nrv, 12, version );
+      store( nrv, 16, std::uint64_t( columns ) );
+      store( nrv, 24, std::uint64_t( rows ) );
+      store( nrv, 32, std::uint64_t( values_size ) );
+
+      std::size_t pos = cmd_tuples.size() + 1;
+      std::memcpy( &nrv[ values ], cmd_tuples.data(), cmd_tuples.size() );
+      for( std::size_t column = 0; column < columns; ++column ) {
+         const std::string_view name = PQfname( pgresult, static_cast< int >( column ) );
+         store( nrv, column_table + column * column_size, std::uint64_t( pos ) );
+         store( nrv, column_table + column * column_size + 8, std::uint32_t( PQfformat( pgresult, static_cast< int >( column ) ) ) );
+         store( nrv, column_table + column * column_size + 12, std::uint32_t( PQftype( pgresult, static_cast< int >( column ) ) ) );
+         std::memcpy( &nrv[ values + pos ], name.data(), name.size() );
+         pos += name.size() + 1;
+      }
+      for( std::size_t row = 0; row < rows; ++row ) {
+         for( std::size_t column = 0; column < columns; ++column ) {
+            const std::size_t i = row * columns + column;
+            store( nrv, offsets + i * sizeof( std::uint64_t ), std::uint64_t( pos ) );
+            const int r = static_cast< int >( row );
+            const int c = static_cast< int >( column );
+            if( PQgetisnull( pgresult, r, c ) != 0 ) {
+               nrv[ nulls + i / 8 ] |= static_cast< char >( 1U << ( i % 8 ) );
+            }
+            const auto length = static_cast< std::size_t >( PQgetlength( pgresult, r, c ) );
+            std::memcpy( &nrv[ values + pos ], PQgetvalue( pgresult, r, c ), length );
+            pos += length + 1;
+         }
+      }
+      store( nrv, offsets + fields * sizeof( std::uint64_t ), std::uint64_t( pos ) );
+      return nrv;
+   }
+
+}  // namespace tao::pq::internal
@@ -0,0 +1,54 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/macaddr.hpp>
+
+#include <stdexcept>
+
+#include <tao/pq/internal/hex.hpp>
+
+namespace tao::pq
+{
+   auto macaddr::from_string( const std::string_view value ) -> macaddr
+   {
+      // the separators are either after every, or every second or third byte, but never mixed
+      std::size_t group = 0;
+      char separator = 0;
+      macaddr nrv;
+      std::size_t n = 0;
+      for( std::size_t i = 0; i < value.size(); ++i ) {
+         const char c = value[ i ];
+         if( ( c == ':' ) || ( c == '-' ) || ( c == '.' ) ) {
+            if( ( n == 0 ) || ( n % 2 != 0 ) || ( n == 12 ) || ( ( separator != 0 ) && ( c != separator ) ) || ( ( group != 0 ) && ( n % group != 0 ) ) ) {
+               throw std::invalid_argument( "invalid value in tao::pq::macaddr for input: " + std::string( value ) );
+            }
+            if( group == 0 ) {
+               group = n;
+               separator = c;
+            }
+            continue;
+         }
+         const int v = internal::hex_value( c );
+         if( ( v < 0 ) || ( n == 12 ) ) {
+            throw std::invalid_argument( "invalid value in tao::pq::macaddr for input: " + std::string( value ) );
+         }
+         nrv.bytes[ n / 2 ] = static_cast< unsigned char >( ( n % 2 == 0 ) ? ( v << 4 ) : ( nrv.bytes[ n / 2 ] | v ) );
+         ++n;
+      }
+      if( ( n != 12 ) || ( ( group != 0 ) && ( 12 % group != 0 ) ) || ( value.back() == separator ) ) {
+         throw std::invalid_argument( "invalid value in tao::pq::macaddr for input: " + std::string( value ) );
+      }
+      return nrv;
+   }
+
+   auto macaddr::to_string() const -> std::string
+   {
+      std::string nrv( 17, ':' );
+      for( std::size_t i = 0; i < bytes.size(); ++i ) {
+         nrv[ 3 * i ] = internal::hex_digits[ bytes[ i ] >> 4 ];
+         nrv[ 3 * i + 1 ] = internal::hex_digits[ bytes[ i ] & 0x0F ];
+      }
+      return nrv;
+   }
+
+}  // namespace tao::pq
@@ -0,0 +1,180 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/pipeline.hpp>
+
+#include <stdexcept>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+
+namespace tao::pq
+{
+   auto deferred_result::get() const -> result
+   {
+      return m_pipeline->claim( m_index );
+   }
+
+   pipeline::pipeline( const private_key& /*unused*/, const std::shared_ptr< pq::connection >& connection )
+      : transaction( connection ),
+        m_previous( current_transaction()->shared_from_this() ),
+        m_queued( 0 ),
+        m_flushed( 0 ),
+        m_synced( 0 ),
+        m_fetched( 0 ),
+        m_syncs( 0 )
+   {
+#if defined( LIBPQ_HAS_PIPELINING )
+      PGconn* pgconn = m_connection->m_pgconn.get();
+      if( PQpipelineStatus( pgconn ) != PQ_PIPELINE_OFF ) {
+         throw std::logic_error( "pipeline already active" );
+      }
+      if( PQenterPipelineMode( pgconn ) != 1 ) {
+         throw std::runtime_error( "unable to enter pipeline mode: " + m_connection->error_message() );
+      }
+#endif
+      current_transaction() = this;
+   }
+
+   pipeline::~pipeline()
+   {
+      if( m_connection && m_connection->is_open() ) {
+         try {
+            finish();
+         }
+         // LCOV_EXCL_START
+         catch( const std::exception& ) {
+            // TAO_LOG( WARNING, "unable to finish pipeline, swallowing exception: " + std::string( e.what() ) );
+         }
+         catch( ... ) {
+            // TAO_LOG( WARNING, "unable to finish pipeline, swallowing unknown exception" );
+         }
+         // LCOV_EXCL_STOP
+      }
+      if( m_connection ) {
+         current_transaction() = m_previous.get();  // LCOV_EXCL_LINE
+      }
+   }
+
+   void pipeline::v_commit()
+   {
+      drain();
+   }
+
+   void pipeline::v_rollback()
+   {
+      // statements which were already sent can not be withdrawn
+      drain();
+   }
+
+   void pipeline::v_reset() noexcept
+   {
+      current_transaction() = m_previous.get();
+      m_connection.reset();
+   }
+
+   auto pipeline::queued() -> deferred_result
+   {
+      const std::size_t index = m_queued++;
+#if !defined( LIBPQ_HAS_PIPELINING )
+      // without pipeline support in libpq, statements are executed immediately
+      fetch();
+#endif
+      return deferred_result( std::static_pointer_cast< pipeline >( shared_from_this() ), index );
+   }
+
+   void pipeline::fetch()
+   {
+      PGconn* pgconn = m_connection->m_pgconn.get();
+      while( true ) {
+         PGresult* pgresult = PQgetResult( pgconn );
+         if( pgresult == nullptr ) {
+            throw std::logic_error( "no result available" );  // LCOV_EXCL_LINE
+         }
+#if defined( LIBPQ_HAS_PIPELINING )
+         if( PQresultStatus( pgresult ) == PGRES_PIPELINE_SYNC ) {
+            PQclear( pgresult );
+            --m_syncs;
+            continue;
+         }
+#endif
+         std::unique_ptr< PGresult, decltype( &PQclear ) > up( pgresult, &PQclear );
+         // consume the results up to the terminating nullptr
+         while( PGresult* next = PQgetResult( pgconn ) ) {
+            up.reset( next );
+         }
+         m_results.emplace( m_fetched++, std::move( up ) );
+         return;
+      }
+   }
+
+   void pipeline::drain()
+   {
+      check_current_transaction();
+      if( m_synced != m_queued ) {
+         sync();
+      }
+      while( m_fetched != m_queued ) {
+         fetch();
+      }
+#if defined( LIBPQ_HAS_PIPELINING )
+      PGconn* pgconn = m_connection->m_pgconn.get();
+      while( m_syncs != 0 ) {
+         PGresult* pgresult = PQgetResult( pgconn );
+         if( pgresult == nullptr ) {
+            throw std::logic_error( "no result available" );  // LCOV_EXCL_LINE
+         }
+         const auto status = PQresultStatus( pgresult );
+         PQclear( pgresult );
+         if( status != PGRES_PIPELINE_SYNC ) {
+            throw std::runtime_error( "unexpected result while waiting for pipeline sync" );  // LCOV_EXCL_LINE
+         }
+         --m_syncs;
+      }
+      if( PQexitPipelineMode( pgconn ) != 1 ) {
+         throw std::runtime_error( "unable to exit pipeline mode: " + m_connection->error_message() );  // LCOV_EXCL_LINE
+      }
+#endif
+   }
+
+   auto pipeline::claim( const std::size_t index ) -> result
+   {
+      if( index >= m_fetched ) {
+         check_current_transaction();
+#if defined( LIBPQ_HAS_PIPELINING )
+         if( index >= m_flushed ) {
+            PGconn* pgconn = m_connection->m_pgconn.get();
+            if( ( PQsendFlushRequest( pgconn ) != 1 ) || ( PQflush( pgconn ) != 0 ) ) {
+               throw std::runtime_error( "unable to flush pipeline: " + m_connection->error_message() );  // LCOV_EXCL_LINE
+            }
+            m_flushed = m_queued;
+         }
+#endif
+         while( index >= m_fetched ) {
+            fetch();
+         }
+      }
+      const auto it = m_results.find( index );
+      if( it == m_results.end() ) {
+         throw std::logic_error( "deferred result already retrieved" );
+      }
+      PGresult* pgresult = it->second.release();
+      m_results.erase( it );
+      return result( pgresult );
+   }
+
+   void pipeline::sync()
+   {
+      check_current_transaction();
+#if defined( LIBPQ_HAS_PIPELINING )
+      if( PQpipelineSync( m_connection->m_pgconn.get() ) != 1 ) {
+         throw std::runtime_error( "unable to sync pipeline: " + m_connection->error_message() );  // LCOV_EXCL_LINE
+      }
+      ++m_syncs;
+#endif
+      m_flushed = m_queued;
+      m_synced = m_queued;
+   }
+
+}  // namespace tao::pq
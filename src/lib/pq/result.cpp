@@ -1,19 +1,38 @@
 // Copyright (c) 2016-2020 Daniel Frey and Dr. Colin Hirsch
 // Please see LICENSE for license or visit https://github.com/taocpp/taopq/
 
-#include <cassert>
 #include <cstring>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <utility>
 
 #include <libpq-fe.h>
 
 #include <tao/pq/result.hpp>
 
+#include <tao/pq/internal/column_index.hpp>
 #include <tao/pq/internal/printf.hpp>
+#include <tao/pq/internal/snapshot.hpp>
 #include <tao/pq/internal/strtox.hpp>
 
 namespace tao::pq
 {
+   namespace
+   {
+      [[nodiscard]] auto make_column_index( PGresult* pgresult ) -> std::shared_ptr< internal::column_index >
+      {
+         try {
+            return std::make_shared< internal::column_index >( pgresult );
+         }
+         catch( ... ) {
+            PQclear( pgresult );
+            throw;
+         }
+      }
+
+   }  // namespace
+
    void result::check_has_result_set() const
    {
       if( m_columns == 0 ) {
@@ -32,8 +51,22 @@ namespace tao::pq
       }
    }
 
+   void result::check_column( const std::size_t column ) const
+   {
+      if( column >= m_columns ) {
+         throw std::out_of_range( internal::printf( "column %zu out of range (0-%zu)", column, m_columns - 1 ) );
+      }
+   }
+
+   auto result::binary_decoder_missing( const std::size_t column, const std::string& type ) const -> std::runtime_error
+   {
+      return std::runtime_error( internal::printf( "binary value in column %zu = %s can not be decoded, tao::pq::result_binary_traits<%s> not specialized", column, name( column ).c_str(), type.c_str() ) );
+   }
+
    result::result( PGresult* pgresult, const mode_t mode )
-      : m_pgresult( pgresult, &PQclear ),
+      : m_index( make_column_index( pgresult ) ),
+        m_pgresult( m_index, pgresult ),
+        m_snapshot( nullptr ),
         m_columns( PQnfields( pgresult ) ),
         m_rows( PQntuples( pgresult ) )
    {
@@ -41,6 +74,10 @@ namespace tao::pq
       switch( status ) {
          case PGRES_COMMAND_OK:
          case PGRES_TUPLES_OK:
+         case PGRES_SINGLE_TUPLE:
+#if defined( LIBPQ_HAS_CHUNK_MODE )
+         case PGRES_TUPLES_CHUNK:
+#endif
             if( mode == mode_t::expect_ok ) {
                return;
             }
@@ -66,15 +103,28 @@ namespace tao::pq
       throw std::runtime_error( "unexpected result: " + res_status );
    }
 
+   result::result( std::unique_ptr< const internal::snapshot >&& snapshot )
+      : m_index( std::make_shared< internal::column_index >( std::move( snapshot ) ) ),
+        m_pgresult( m_index, nullptr ),
+        m_snapshot( m_index->snapshot() ),
+        m_columns( m_snapshot->columns() ),
+        m_rows( m_snapshot->rows() )
+   {}
+
+   auto result::cmd_tuples() const noexcept -> const char*
+   {
+      return ( m_snapshot != nullptr ) ? m_snapshot->cmd_tuples() : PQcmdTuples( m_pgresult.get() );
+   }
+
    auto result::has_rows_affected() const noexcept -> bool
    {
-      const char* str = PQcmdTuples( m_pgresult.get() );
+      const char* str = cmd_tuples();
       return str[ 0 ] != '\0';
    }
 
    auto result::rows_affected() const -> std::size_t
    {
-      const char* str = PQcmdTuples( m_pgresult.get() );
+      const char* str = cmd_tuples();
       if( str[ 0 ] == '\0' ) {
          throw std::logic_error( "statement does not return affected rows" );
       }
@@ -83,23 +133,26 @@ namespace tao::pq
 
    auto result::name( const std::size_t column ) const -> std::string
    {
-      if( column >= m_columns ) {
-         throw std::out_of_range( internal::printf( "column %zu out of range (0-%zu)", column, m_columns - 1 ) );
-      }
-      return PQfname( m_pgresult.get(), static_cast< int >( column ) );
+      check_column( column );
+      return ( m_snapshot != nullptr ) ? m_snapshot->name( column ) : PQfname( m_pgresult.get(), static_cast< int >( column ) );
    }
 
    auto result::index( const std::string& in_name ) const -> std::size_t
    {
-      const int column = PQfnumber( m_pgresult.get(), in_name.c_str() );
-      if( column < 0 ) {
-         assert( column == -1 );
+      const std::size_t column = m_index->find( in_name.c_str() );
+      if( column == internal::column_index::npos ) {
          check_has_result_set();
          throw std::out_of_range( "column not found: " + in_name );
       }
       return column;
    }
 
+   auto result::is_binary( const std::size_t column ) const -> bool
+   {
+      check_column( column );
+      return column_is_binary( column );
+   }
+
    auto result::empty() const -> bool
    {
       return size() == 0;
@@ -113,21 +166,19 @@ namespace tao::pq
 
    auto result::begin() const -> result::const_iterator
    {
-      return row( *this, 0, 0, m_columns );
+      return const_iterator( this, nullptr, 0 );
    }
 
    auto result::end() const -> result::const_iterator
    {
-      return row( *this, size(), 0, m_columns );
+      return const_iterator( this, nullptr, size() );
    }
 
    auto result::is_null( const std::size_t row, const std::size_t column ) const -> bool
    {
       check_row( row );
-      if( column >= m_columns ) {
-         throw std::out_of_range( internal::printf( "column %zu out of range (0-%zu)", column, m_columns - 1 ) );
-      }
-      return PQgetisnull( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) ) != 0;
+      check_column( column );
+      return value_is_null( row, column );
    }
 
    auto result::get( const std::size_t row, const std::size_t column ) const -> const char*
@@ -135,7 +186,14 @@ namespace tao::pq
       if( is_null( row, column ) ) {
          throw std::runtime_error( internal::printf( "unexpected NULL value in row %zu column %zu = %s", row, column, name( column ).c_str() ) );
       }
-      return PQgetvalue( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) );
+      return value( row, column );
+   }
+
+   auto result::length( const std::size_t row, const std::size_t column ) const -> std::size_t
+   {
+      check_row( row );
+      check_column( column );
+      return value_length( row, column );
    }
 
    auto result::at( const std::size_t row ) const -> pq::row
@@ -144,4 +202,28 @@ namespace tao::pq
       return ( *this )[ row ];
    }
 
+   auto result::snapshot() const -> result
+   {
+      return deserialize( serialize() );
+   }
+
+   auto result::serialize() const -> std::string
+   {
+      if( m_snapshot != nullptr ) {
+         return std::string( m_snapshot->bytes() );
+      }
+      return internal::snapshot::serialize( m_pgresult.get() );
+   }
+
+   auto result::deserialize( std::shared_ptr< const void > owner, const char* data, const std::size_t size ) -> result
+   {
+      return result( std::make_unique< const internal::snapshot >( std::move( owner ), data, size ) );
+   }
+
+   auto result::deserialize( std::string data ) -> result
+   {
+      const auto owner = std::make_shared< const std::string >( std::move( data ) );
+      return deserialize( owner, owner->data(), owner->size() );
+   }
+
 }  // namespace tao::pq
@@ -0,0 +1,298 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/result_binary_traits.hpp>
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include <tao/pq/internal/demangle.hpp>
+#include <tao/pq/internal/endian.hpp>
+#include <tao/pq/internal/numeric.hpp>
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      template< typename T >
+      [[nodiscard]] auto ntoh( const char* value ) noexcept -> T
+      {
+         T v;
+         std::memcpy( &v, value, sizeof( T ) );
+         return internal::hton( v );
+      }
+
+      template< typename T >
+      [[nodiscard]] auto invalid_size( const std::size_t size ) -> std::runtime_error
+      {
+         return std::runtime_error( internal::printf( "invalid size in tao::pq::result_binary_traits<%s> for input of %zu bytes", internal::demangle< T >().c_str(), size ) );
+      }
+
+      template< typename T >
+      [[nodiscard]] auto invalid_type( const Oid type ) -> std::runtime_error
+      {
+         return std::runtime_error( internal::printf( "invalid type in tao::pq::result_binary_traits<%s> for input of type oid %u", internal::demangle< T >().c_str(), unsigned( type ) ) );
+      }
+
+      template< typename T >
+      void check_size( const std::size_t size, const std::size_t expected )
+      {
+         if( size != expected ) {
+            throw invalid_size< T >( size );
+         }
+      }
+
+      // accepts integral numeric values, e.g. unsigned 64 bit parameters which were sent as numeric,
+      // without __int128 the decimal's coefficient limits the values to those of long long
+      template< typename T >
+      [[nodiscard]] auto from_numeric( const char* value, const std::size_t size ) -> T
+      {
+         const decimal d = internal::decode_numeric( value, size );
+         decimal::coefficient_type v = d.coefficient;
+         for( int i = 0; i < d.scale; ++i ) {
+            if( v % 10 != 0 ) {
+               throw std::runtime_error( internal::printf( "invalid value in tao::pq::result_binary_traits<%s> for numeric input with fractional digits", internal::demangle< T >().c_str() ) );
+            }
+            v /= 10;
+         }
+         if( ( v < 0 ) && ( std::is_unsigned_v< T > || ( v < std::numeric_limits< T >::min() ) ) ) {
+            throw std::underflow_error( internal::printf( "underflow error in tao::pq::result_binary_traits<%s> for numeric input", internal::demangle< T >().c_str() ) );
+         }
+         if( ( v > 0 ) && ( static_cast< decimal::unsigned_coefficient_type >( v ) > std::numeric_limits< T >::max() ) ) {
+            throw std::overflow_error( internal::printf( "overflow error in tao::pq::result_binary_traits<%s> for numeric input", internal::demangle< T >().c_str() ) );
+         }
+         return static_cast< T >( v );
+      }
+
+      // accepts int2, int4, int8, and numeric values, the range is checked for the target type
+      template< typename T >
+      [[nodiscard]] auto from_integer( const char* value, const std::size_t size, const Oid type ) -> T
+      {
+         static_assert( sizeof( short ) == 2 );
+         static_assert( sizeof( int ) == 4 );
+         static_assert( sizeof( long long ) == 8 );
+
+         long long v;
+         switch( type ) {
+            case 21:  // int2
+               check_size< T >( size, 2 );
+               v = ntoh< short >( value );
+               break;
+
+            case 23:  // int4
+               check_size< T >( size, 4 );
+               v = ntoh< int >( value );
+               break;
+
+            case 20:  // int8
+               check_size< T >( size, 8 );
+               v = ntoh< long long >( value );
+               break;
+
+            case 1700:  // numeric
+               return from_numeric< T >( value, size );
+
+            default:
+               throw invalid_type< T >( type );
+         }
+         if constexpr( std::is_signed_v< T > ) {
+            if( v < std::numeric_limits< T >::min() ) {
+               throw std::underflow_error( internal::printf( "underflow error in tao::pq::result_binary_traits<%s> for input: %lld", internal::demangle< T >().c_str(), v ) );
+            }
+            if( v > std::numeric_limits< T >::max() ) {
+               throw std::overflow_error( internal::printf( "overflow error in tao::pq::result_binary_traits<%s> for input: %lld", internal::demangle< T >().c_str(), v ) );
+            }
+         }
+         else {
+            if( v < 0 ) {
+               throw std::underflow_error( internal::printf( "underflow error in tao::pq::result_binary_traits<%s> for input: %lld", internal::demangle< T >().c_str(), v ) );
+            }
+            if( static_cast< unsigned long long >( v ) > std::numeric_limits< T >::max() ) {
+               throw std::overflow_error( internal::printf( "overflow error in tao::pq::result_binary_traits<%s> for input: %lld", internal::demangle< T >().c_str(), v ) );
+            }
+         }
+         return static_cast< T >( v );
+      }
+
+      // accepts float4 and float8 values
+      template< typename T >
+      [[nodiscard]] auto from_floating_point( const char* value, const std::size_t size, const Oid type ) -> T
+      {
+         switch( type ) {
+            case 700:  // float4
+               check_size< T >( size, 4 );
+               return static_cast< T >( ntoh< float >( value ) );
+
+            case 701:  // float8
+               check_size< T >( size, 8 );
+               return static_cast< T >( ntoh< double >( value ) );
+
+            default:
+               throw invalid_type< T >( type );
+         }
+      }
+
+   }  // namespace
+
+   auto result_binary_traits< bool >::from( const char* value, const std::size_t size, const Oid type ) -> bool
+   {
+      if( type != 16 ) {
+         throw invalid_type< bool >( type );
+      }
+      check_size< bool >( size, 1 );
+      return value[ 0 ] != 0;
+   }
+
+   auto result_binary_traits< char >::from( const char* value, const std::size_t size, const Oid type ) -> char
+   {
+      // "char", or a single character of text, varchar or bpchar
+      if( ( type != 18 ) && ( type != 25 ) && ( type != 1042 ) && ( type != 1043 ) ) {
+         throw invalid_type< char >( type );
+      }
+      check_size< char >( size, 1 );
+      return value[ 0 ];
+   }
+
+   auto result_binary_traits< signed char >::from( const char* value, const std::size_t size, const Oid type ) -> signed char
+   {
+      return from_integer< signed char >( value, size, type );
+   }
+
+   auto result_binary_traits< unsigned char >::from( const char* value, const std::size_t size, const Oid type ) -> unsigned char
+   {
+      return from_integer< unsigned char >( value, size, type );
+   }
+
+   auto result_binary_traits< short >::from( const char* value, const std::size_t size, const Oid type ) -> short
+   {
+      return from_integer< short >( value, size, type );
+   }
+
+   auto result_binary_traits< unsigned short >::from( const char* value, const std::size_t size, const Oid type ) -> unsigned short
+   {
+      return from_integer< unsigned short >( value, size, type );
+   }
+
+   auto result_binary_traits< int >::from( const char* value, const std::size_t size, const Oid type ) -> int
+   {
+      return from_integer< int >( value, size, type );
+   }
+
+   auto result_binary_traits< unsigned >::from( const char* value, const std::size_t size, const Oid type ) -> unsigned
+   {
+      return from_integer< unsigned >( value, size, type );
+   }
+
+   auto result_binary_traits< long >::from( const char* value, const std::size_t size, const Oid type ) -> long
+   {
+      return from_integer< long >( value, size, type );
+   }
+
+   auto result_binary_traits< unsigned long >::from( const char* value, const std::size_t size, const Oid type ) -> unsigned long
+   {
+      return from_integer< unsigned long >( value, size, type );
+   }
+
+   auto result_binary_traits< long long >::from( const char* value, const std::size_t size, const Oid type ) -> long long
+   {
+      return from_integer< long long >( value, size, type );
+   }
+
+   auto result_binary_traits< unsigned long long >::from( const char* value, const std::size_t size, const Oid type ) -> unsigned long long
+   {
+      return from_integer< unsigned long long >( value, size, type );
+   }
+
+   auto result_binary_traits< decimal >::from( const char* value, const std::size_t size, const Oid type ) -> decimal
+   {
+      if( type != 1700 ) {
+         throw invalid_type< decimal >( type );
+      }
+      return internal::decode_numeric( value, size );
+   }
+
+   auto result_binary_traits< uuid >::from( const char* value, const std::size_t size, const Oid type ) -> uuid
+   {
+      if( type != 2950 ) {
+         throw invalid_type< uuid >( type );
+      }
+      uuid nrv;
+      if( size != nrv.bytes.size() ) {
+         throw invalid_size< uuid >( size );
+      }
+      std::memcpy( nrv.bytes.data(), value, size );
+      return nrv;
+   }
+
+   auto result_binary_traits< macaddr >::from( const char* value, const std::size_t size, const Oid type ) -> macaddr
+   {
+      if( type != 829 ) {
+         throw invalid_type< macaddr >( type );
+      }
+      macaddr nrv;
+      if( size != nrv.bytes.size() ) {
+         throw invalid_size< macaddr >( size );
+      }
+      std::memcpy( nrv.bytes.data(), value, size );
+      return nrv;
+   }
+
+   auto result_binary_traits< inet >::from( const char* value, const std::size_t size, const Oid type ) -> inet
+   {
+      // inet or cidr
+      if( ( type != 869 ) && ( type != 650 ) ) {
+         throw invalid_type< inet >( type );
+      }
+      if( size < 4 ) {
+         throw invalid_size< inet >( size );
+      }
+      inet nrv;
+      switch( value[ 0 ] ) {
+         case 2:
+            nrv.family = inet::family_type::ipv4;
+            break;
+
+         case 3:
+            nrv.family = inet::family_type::ipv6;
+            break;
+
+         default:
+            throw std::runtime_error( internal::printf( "invalid address family in tao::pq::result_binary_traits<tao::pq::inet>: %d", value[ 0 ] ) );
+      }
+      if( ( static_cast< unsigned char >( value[ 3 ] ) != nrv.size() ) || ( size != 4 + nrv.size() ) ) {
+         throw invalid_size< inet >( size );
+      }
+      nrv.bits = static_cast< unsigned char >( value[ 1 ] );
+      if( nrv.bits > nrv.max_bits() ) {
+         throw std::runtime_error( internal::printf( "invalid netmask in tao::pq::result_binary_traits<tao::pq::inet>: %u bits", unsigned( nrv.bits ) ) );
+      }
+      std::memcpy( nrv.address.data(), value + 4, nrv.size() );
+      return nrv;
+   }
+
+   auto result_binary_traits< cidr >::from( const char* value, const std::size_t size, const Oid type ) -> cidr
+   {
+      cidr nrv{ result_binary_traits< inet >::from( value, size, type ) };
+      nrv.validate();
+      return nrv;
+   }
+
+   auto result_binary_traits< float >::from( const char* value, const std::size_t size, const Oid type ) -> float
+   {
+      return from_floating_point< float >( value, size, type );
+   }
+
+   auto result_binary_traits< double >::from( const char* value, const std::size_t size, const Oid type ) -> double
+   {
+      return from_floating_point< double >( value, size, type );
+   }
+
+   auto result_binary_traits< long double >::from( const char* value, const std::size_t size, const Oid type ) -> long double
+   {
+      return from_floating_point< long double >( value, size, type );
+   }
+
+}  // namespace tao::pq
@@ -0,0 +1,187 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/result_cache.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <iterator>
+
+namespace tao::pq
+{
+   void result_cache::append_parameter( std::string& key, const Oid type, const char* value, const int length, const int format )
+   {
+      // type, format and a length prefix keep the key unambiguous, -1 marks NULL
+      const std::int64_t size = ( value == nullptr ) ? -1 : ( ( format == 0 ) ? static_cast< std::int64_t >( std::strlen( value ) ) : length );
+      key.append( reinterpret_cast< const char* >( &type ), sizeof( type ) );
+      key += static_cast< char >( format );
+      key.append( reinterpret_cast< const char* >( &size ), sizeof( size ) );
+      if( size > 0 ) {
+         key.append( value, static_cast< std::size_t >( size ) );
+      }
+   }
+
+   void result_cache::listen( const std::vector< std::string >& channels )
+   {
+      for( const auto& channel : channels ) {
+         if( m_channels.find( channel ) == m_channels.end() ) {
+            m_listener->listen( channel );
+            m_channels.insert( channel );
+         }
+      }
+   }
+
+   void result_cache::handle_notifications_locked()
+   {
+      if( m_channels.empty() ) {
+         return;
+      }
+      while( const auto n = m_listener->get_notification() ) {
+         invalidate_locked( n->channel() );
+      }
+   }
+
+   void result_cache::invalidate_locked( const std::string_view channel )
+   {
+      ++m_invalidations;
+      for( auto it = m_entries.begin(); it != m_entries.end(); ) {
+         const auto& channels = it->channels;
+         if( std::find( channels.begin(), channels.end(), channel ) != channels.end() ) {
+            erase( it++ );
+         }
+         else {
+            ++it;
+         }
+      }
+   }
+
+   void result_cache::purge_expired_locked() noexcept
+   {
+      const auto now = std::chrono::steady_clock::now();
+      for( auto it = m_entries.begin(); it != m_entries.end(); ) {
+         if( it->expires <= now ) {
+            erase( it++ );
+         }
+         else {
+            ++it;
+         }
+      }
+   }
+
+   void result_cache::erase( const std::list< entry >::iterator it ) noexcept
+   {
+      m_size -= it->size;
+      m_index.erase( it->key );
+      m_entries.erase( it );
+   }
+
+   auto result_cache::find( const std::string& key ) -> std::optional< result >
+   {
+      handle_notifications_locked();
+      const auto it = m_index.find( key );
+      if( it == m_index.end() ) {
+         return std::nullopt;
+      }
+      if( it->second->expires <= std::chrono::steady_clock::now() ) {
+         erase( it->second );
+         return std::nullopt;
+      }
+      m_entries.splice( m_entries.begin(), m_entries, it->second );
+      return m_entries.front().value;
+   }
+
+   auto result_cache::insert( std::string&& key, const result& r, const cache_policy& policy, const std::uint64_t invalidations ) -> result
+   {
+      std::string data = r.serialize();
+      const std::size_t size = sizeof( entry ) + key.size() + data.size();
+      auto nrv = result::deserialize( std::move( data ) );
+
+      // an invalidation while the statement was executed might apply to the result, which is therefore not cached
+      handle_notifications_locked();
+      if( ( invalidations != m_invalidations ) || ( size > m_budget ) ) {
+         return nrv;
+      }
+      const auto it = m_index.find( key );
+      if( it != m_index.end() ) {
+         erase( it->second );
+      }
+      while( m_size + size > m_budget ) {
+         erase( std::prev( m_entries.end() ) );
+      }
+      m_entries.push_front( entry{ std::move( key ), nrv, std::chrono::steady_clock::now() + policy.ttl, policy.channels, size } );
+      m_index.emplace( m_entries.front().key, m_entries.begin() );
+      m_size += size;
+      return nrv;
+   }
+
+   auto result_cache::create( const std::shared_ptr< connection_pool >& pool, const std::size_t budget ) -> std::shared_ptr< result_cache >
+   {
+      return std::make_shared< result_cache >( result_cache::private_key(), pool, budget );
+   }
+
+   result_cache::result_cache( const private_key& /*unused*/, const std::shared_ptr< connection_pool >& pool, const std::size_t budget )  // NOLINT(modernize-pass-by-value)
+      : m_pool( pool ),
+        m_budget( budget ),
+        m_listener( pool->connection() )
+   {}
+
+   result_cache::~result_cache()
+   {
+      // the connection is returned to the pool, which must not receive the cache's notifications
+      if( !m_channels.empty() && m_listener->is_open() ) {
+         try {
+            m_listener->execute( "UNLISTEN *" );
+         }
+         // LCOV_EXCL_START
+         catch( const std::exception& ) {
+            // TAO_LOG( WARNING, "unable to unlisten, swallowing exception: " + std::string( e.what() ) );
+         }
+         catch( ... ) {
+            // TAO_LOG( WARNING, "unable to unlisten, swallowing unknown exception" );
+         }
+         // LCOV_EXCL_STOP
+      }
+   }
+
+   void result_cache::handle_notifications()
+   {
+      const std::lock_guard lock( m_mutex );
+      handle_notifications_locked();
+   }
+
+   auto result_cache::socket() const -> int
+   {
+      return m_listener->socket();
+   }
+
+   void result_cache::invalidate( const std::string& channel )
+   {
+      const std::lock_guard lock( m_mutex );
+      invalidate_locked( channel );
+   }
+
+   void result_cache::clear()
+   {
+      const std::lock_guard lock( m_mutex );
+      ++m_invalidations;
+      m_index.clear();
+      m_entries.clear();
+      m_size = 0;
+   }
+
+   auto result_cache::size() -> std::size_t
+   {
+      const std::lock_guard lock( m_mutex );
+      purge_expired_locked();
+      return m_entries.size();
+   }
+
+   auto result_cache::memory() -> std::size_t
+   {
+      const std::lock_guard lock( m_mutex );
+      purge_expired_locked();
+      return m_size;
+   }
+
+}  // namespace tao::pq
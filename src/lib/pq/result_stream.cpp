@@ -0,0 +1,93 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/result_stream.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      void discard_results( PGconn* pgconn ) noexcept
+      {
+         while( PGresult* pgresult = PQgetResult( pgconn ) ) {
+            PQclear( pgresult );
+         }
+      }
+
+   }  // namespace
+
+   result_stream::result_stream( const std::shared_ptr< transaction >& transaction, const std::size_t rows_per_chunk )  // NOLINT(modernize-pass-by-value)
+      : m_transaction( transaction ),
+        m_connection( transaction->m_connection ),
+        m_row( 0 ),
+        m_done( false )
+   {
+      PGconn* pgconn = m_connection->m_pgconn.get();
+#if defined( LIBPQ_HAS_CHUNK_MODE )
+      const int rc = ( rows_per_chunk > 1 ) ? PQsetChunkedRowsMode( pgconn, static_cast< int >( rows_per_chunk ) ) : PQsetSingleRowMode( pgconn );
+#else
+      // without chunk mode in libpq, rows are always received one at a time
+      (void)rows_per_chunk;
+      const int rc = PQsetSingleRowMode( pgconn );
+#endif
+      if( rc != 1 ) {
+         discard_results( pgconn );
+         m_done = true;
+         throw std::runtime_error( "unable to switch to single row mode: " + m_connection->error_message() );  // LCOV_EXCL_LINE
+      }
+      fetch();
+   }
+
+   result_stream::~result_stream()
+   {
+      if( m_connection && !m_done ) {
+         // the remaining rows are read and discarded, the connection would be unusable otherwise
+         discard_results( m_connection->m_pgconn.get() );
+      }
+   }
+
+   void result_stream::fetch()
+   {
+      PGconn* pgconn = m_connection->m_pgconn.get();
+      PGresult* pgresult = PQgetResult( pgconn );
+      if( pgresult == nullptr ) {
+         m_done = true;
+         throw std::logic_error( "no result available" );  // LCOV_EXCL_LINE
+      }
+      switch( PQresultStatus( pgresult ) ) {
+         case PGRES_SINGLE_TUPLE:
+#if defined( LIBPQ_HAS_CHUNK_MODE )
+         case PGRES_TUPLES_CHUNK:
+#endif
+            m_result.emplace( result( pgresult ) );
+            m_row = 0;
+            return;
+
+         default:
+            break;
+      }
+      // the final result terminates the stream, it may also report an error
+      m_done = true;
+      discard_results( pgconn );
+      result final( pgresult );
+      m_result.emplace( std::move( final ) );
+      m_row = 0;
+   }
+
+   void result_stream::advance()
+   {
+      ++m_row;
+      while( !m_done && ( m_row >= m_result->m_rows ) ) {
+         fetch();
+      }
+   }
+
+}  // namespace tao::pq
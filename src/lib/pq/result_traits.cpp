@@ -6,6 +6,7 @@
 #include <limits>
 #include <stdexcept>
 
+#include <tao/pq/internal/from_chars.hpp>
 #include <tao/pq/internal/strtox.hpp>
 
 namespace tao::pq
@@ -33,6 +34,9 @@ namespace tao::pq
 
    auto result_traits< signed char >::from( const char* value ) -> signed char
    {
+      if( const auto nrv = internal::from_chars< signed char >( value ) ) {
+         return *nrv;
+      }
       const long v = internal::strtol( value, 10 );
       if( v < std::numeric_limits< signed char >::min() ) {
          throw std::underflow_error( "underflow error in tao::pq::result_traits<signed char> for input: " + std::string( value ) );
@@ -45,6 +49,9 @@ namespace tao::pq
 
    auto result_traits< unsigned char >::from( const char* value ) -> unsigned char
    {
+      if( const auto nrv = internal::from_chars< unsigned char >( value ) ) {
+         return *nrv;
+      }
       const unsigned long v = internal::strtoul( value, 10 );
       if( v > std::numeric_limits< unsigned char >::max() ) {
          throw std::overflow_error( "overflow error in tao::pq::result_traits<unsigned char> for input: " + std::string( value ) );
@@ -54,6 +61,9 @@ namespace tao::pq
 
    auto result_traits< short >::from( const char* value ) -> short
    {
+      if( const auto nrv = internal::from_chars< short >( value ) ) {
+         return *nrv;
+      }
       const long v = internal::strtol( value, 10 );
       if( v < std::numeric_limits< short >::min() ) {
          throw std::underflow_error( "underflow error in tao::pq::result_traits<short> for input: " + std::string( value ) );
@@ -66,6 +76,9 @@ namespace tao::pq
 
    auto result_traits< unsigned short >::from( const char* value ) -> unsigned short
    {
+      if( const auto nrv = internal::from_chars< unsigned short >( value ) ) {
+         return *nrv;
+      }
       const unsigned long v = internal::strtoul( value, 10 );
       if( v > std::numeric_limits< unsigned short >::max() ) {
          throw std::overflow_error( "overflow error in tao::pq::result_traits<unsigned short> for input: " + std::string( value ) );
@@ -75,6 +88,9 @@ namespace tao::pq
 
    auto result_traits< int >::from( const char* value ) -> int
    {
+      if( const auto nrv = internal::from_chars< int >( value ) ) {
+         return *nrv;
+      }
       const long v = internal::strtol( value, 10 );
       if( v < std::numeric_limits< int >::min() ) {
          throw std::underflow_error( "underflow error in tao::pq::result_traits<int> for input: " + std::string( value ) );
@@ -87,6 +103,9 @@ namespace tao::pq
 
    auto result_traits< unsigned >::from( const char* value ) -> unsigned
    {
+      if( const auto nrv = internal::from_chars< unsigned >( value ) ) {
+         return *nrv;
+      }
       const unsigned long v = internal::strtoul( value, 10 );
       if( v > std::numeric_limits< unsigned >::max() ) {
          throw std::overflow_error( "overflow error in tao::pq::result_traits<unsigned> for input: " + std::string( value ) );
@@ -96,36 +115,57 @@ namespace tao::pq
 
    auto result_traits< long >::from( const char* value ) -> long
    {
+      if( const auto nrv = internal::from_chars< long >( value ) ) {
+         return *nrv;
+      }
       return internal::strtol( value, 10 );
    }
 
    auto result_traits< unsigned long >::from( const char* value ) -> unsigned long
    {
+      if( const auto nrv = internal::from_chars< unsigned long >( value ) ) {
+         return *nrv;
+      }
       return internal::strtoul( value, 10 );
    }
 
    auto result_traits< long long >::from( const char* value ) -> long long
    {
+      if( const auto nrv = internal::from_chars< long long >( value ) ) {
+         return *nrv;
+      }
       return internal::strtoll( value, 10 );
    }
 
    auto result_traits< unsigned long long >::from( const char* value ) -> unsigned long long
    {
+      if( const auto nrv = internal::from_chars< unsigned long long >( value ) ) {
+         return *nrv;
+      }
       return internal::strtoull( value, 10 );
    }
 
    auto result_traits< float >::from( const char* value ) -> float
    {
+      if( const auto nrv = internal::from_chars< float >( value ) ) {
+         return *nrv;
+      }
       return internal::strtof( value );
    }
 
    auto result_traits< double >::from( const char* value ) -> double
    {
+      if( const auto nrv = internal::from_chars< double >( value ) ) {
+         return *nrv;
+      }
       return internal::strtod( value );
    }
 
    auto result_traits< long double >::from( const char* value ) -> long double
    {
+      if( const auto nrv = internal::from_chars< long double >( value ) ) {
+         return *nrv;
+      }
       return internal::strtold( value );
    }
 
@@ -1,18 +1,65 @@
 // Copyright (c) 2016-2020 Daniel Frey and Dr. Colin Hirsch
 // Please see LICENSE for license or visit https://github.com/taocpp/taopq/
 
+#include <cassert>
+
 #include <tao/pq/result.hpp>
 #include <tao/pq/row.hpp>
 
+#include <tao/pq/internal/column_index.hpp>
+
 namespace tao::pq
 {
    void row::ensure_column( const std::size_t column ) const
    {
+      if( m_row >= m_result.m_rows ) {
+         m_result.check_row( m_row );
+      }
       if( column >= m_columns ) {
          throw std::out_of_range( internal::printf( "column %zu out of range (0-%zu)", column, m_columns - 1 ) );
       }
    }
 
+   auto row::is_null_unchecked( const std::size_t column ) const noexcept -> bool
+   {
+      assert( ( m_row < m_result.m_rows ) && ( column < m_columns ) );
+      return m_result.value_is_null( m_row, m_offset + column );
+   }
+
+   auto row::get_unchecked( const std::size_t column ) const noexcept -> const char*
+   {
+      assert( ( m_row < m_result.m_rows ) && ( column < m_columns ) );
+      return m_result.value( m_row, m_offset + column );
+   }
+
+   auto row::is_binary_unchecked( const std::size_t column ) const noexcept -> bool
+   {
+      assert( column < m_columns );
+      return m_result.column_is_binary( m_offset + column );
+   }
+
+   auto row::length_unchecked( const std::size_t column ) const noexcept -> std::size_t
+   {
+      assert( ( m_row < m_result.m_rows ) && ( column < m_columns ) );
+      return m_result.value_length( m_row, m_offset + column );
+   }
+
+   auto row::type_unchecked( const std::size_t column ) const noexcept -> Oid
+   {
+      assert( column < m_columns );
+      return m_result.column_type( m_offset + column );
+   }
+
+   auto row::unexpected_null( const std::size_t column ) const -> std::runtime_error
+   {
+      return std::runtime_error( internal::printf( "unexpected NULL value in row %zu column %zu = %s", m_row, m_offset + column, name( column ).c_str() ) );
+   }
+
+   auto row::binary_decoder_missing( const std::size_t column, const std::string& type ) const -> std::runtime_error
+   {
+      return std::runtime_error( internal::printf( "binary value in column %zu = %s can not be decoded, tao::pq::result_binary_traits<%s> not specialized", column, name( column ).c_str(), type.c_str() ) );
+   }
+
    auto row::slice( const std::size_t offset, const std::size_t in_columns ) const -> row
    {
       if( in_columns == 0 ) {
@@ -31,19 +78,9 @@ namespace tao::pq
 
    auto row::index( const std::string& in_name ) const -> std::size_t
    {
-      const std::size_t n = m_result.index( in_name );
-      if( n >= m_offset ) {
-         if( n - m_offset < m_columns ) {
-            return n - m_offset;
-         }
-      }
-      else {
-         const std::string adapted_name = m_result.name( n );
-         for( std::size_t pos = 0; pos < m_columns; ++pos ) {
-            if( name( pos ) == adapted_name ) {
-               return pos;
-            }
-         }
+      const std::size_t n = m_result.m_index->find( in_name.c_str(), m_offset );
+      if( n - m_offset < m_columns ) {
+         return n - m_offset;
       }
       throw std::out_of_range( "column not found: " + in_name );
    }
@@ -60,4 +97,16 @@ namespace tao::pq
       return m_result.get( m_row, m_offset + column );
    }
 
+   auto row::is_binary( const std::size_t column ) const -> bool
+   {
+      ensure_column( column );
+      return m_result.is_binary( m_offset + column );
+   }
+
+   auto row::length( const std::size_t column ) const -> std::size_t
+   {
+      ensure_column( column );
+      return m_result.length( m_row, m_offset + column );
+   }
+
 }  // namespace tao::pq
@@ -0,0 +1,24 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/scheduler.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      thread_local scheduler* current_scheduler = nullptr;
+
+   }  // namespace
+
+   auto scheduler::current() noexcept -> scheduler*
+   {
+      return current_scheduler;
+   }
+
+   void scheduler::set_current( scheduler* s ) noexcept
+   {
+      current_scheduler = s;
+   }
+
+}  // namespace tao::pq
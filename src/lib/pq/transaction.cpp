@@ -7,6 +7,7 @@
 
 #include <tao/pq/connection.hpp>
 #include <tao/pq/internal/printf.hpp>
+#include <tao/pq/pipeline.hpp>
 
 namespace tao::pq
 {
@@ -86,12 +87,22 @@ namespace tao::pq
       private:
          void v_commit() override
          {
-            execute( "COMMIT TRANSACTION" );
+            execute( v_commit_statement() );
          }
 
          void v_rollback() override
          {
-            execute( "ROLLBACK TRANSACTION" );
+            execute( v_rollback_statement() );
+         }
+
+         [[nodiscard]] auto v_commit_statement() const -> std::string override
+         {
+            return "COMMIT TRANSACTION";
+         }
+
+         [[nodiscard]] auto v_rollback_statement() const -> std::string override
+         {
+            return "ROLLBACK TRANSACTION";
          }
       };
 
@@ -131,12 +142,22 @@ namespace tao::pq
       private:
          void v_commit() override
          {
-            execute( internal::printf( "RELEASE SAVEPOINT \"TAOPQ_%p\"", static_cast< void* >( this ) ) );
+            execute( v_commit_statement() );
          }
 
          void v_rollback() override
          {
-            execute( internal::printf( "ROLLBACK TO \"TAOPQ_%p\"", static_cast< void* >( this ) ) );
+            execute( v_rollback_statement() );
+         }
+
+         [[nodiscard]] auto v_commit_statement() const -> std::string override
+         {
+            return internal::printf( "RELEASE SAVEPOINT \"TAOPQ_%p\"", static_cast< const void* >( this ) );
+         }
+
+         [[nodiscard]] auto v_rollback_statement() const -> std::string override
+         {
+            return internal::printf( "ROLLBACK TO \"TAOPQ_%p\"", static_cast< const void* >( this ) );
          }
       };
 
@@ -153,6 +174,16 @@ namespace tao::pq
       return m_connection->m_current_transaction;
    }
 
+   auto transaction::v_commit_statement() const -> std::string
+   {
+      return std::string();
+   }
+
+   auto transaction::v_rollback_statement() const -> std::string
+   {
+      return std::string();
+   }
+
    void transaction::check_current_transaction() const
    {
       if( !m_connection || this != current_transaction() ) {
@@ -160,15 +191,34 @@ namespace tao::pq
       }
    }
 
-   auto transaction::execute_params( const char* statement,
-                                     const int n_params,
-                                     const Oid types[],
-                                     const char* const values[],
-                                     const int lengths[],
-                                     const int formats[] ) -> result
+   void transaction::send_params( const char* statement,
+                                  const int n_params,
+                                  const Oid types[],
+                                  const char* const values[],
+                                  const int lengths[],
+                                  const int formats[],
+                                  const result_format format )
    {
       check_current_transaction();
-      return m_connection->execute_params( statement, n_params, types, values, lengths, formats );
+      m_connection->send_params( statement, n_params, types, values, lengths, formats, format );
+   }
+
+   void transaction::send_params( const prepared_statement& statement,
+                                  const int n_params,
+                                  const Oid /*unused*/[],
+                                  const char* const values[],
+                                  const int lengths[],
+                                  const int formats[],
+                                  const result_format format )
+   {
+      check_current_transaction();
+      m_connection->send_prepared( statement.name().c_str(), n_params, values, lengths, formats, format );
+   }
+
+   auto transaction::get_result() -> result
+   {
+      check_current_transaction();
+      return m_connection->get_result();
    }
 
    auto transaction::underlying_raw_ptr() const noexcept -> PGconn*
@@ -206,6 +256,29 @@ namespace tao::pq
       v_reset();
    }
 
+   auto transaction::async_end( const std::string& statement, void ( transaction::*end )() ) -> async_result
+   {
+      check_current_transaction();
+      if( statement.empty() ) {
+         ( this->*end )();
+         return async_result( result( PQmakeEmptyPGresult( nullptr, PGRES_COMMAND_OK ) ) );
+      }
+      // the transaction is reset once the result was retrieved
+      async_result nrv( shared_from_this(), true );
+      send( statement );
+      return nrv;
+   }
+
+   auto transaction::async_commit() -> async_result
+   {
+      return async_end( v_commit_statement(), &transaction::commit );
+   }
+
+   auto transaction::async_rollback() -> async_result
+   {
+      return async_end( v_rollback_statement(), &transaction::rollback );
+   }
+
    auto transaction::subtransaction() -> std::shared_ptr< transaction >
    {
       check_current_transaction();
@@ -215,4 +288,10 @@ namespace tao::pq
       return std::make_shared< nested_transaction >( m_connection );
    }
 
+   auto transaction::pipeline() -> std::shared_ptr< pq::pipeline >
+   {
+      check_current_transaction();
+      return std::make_shared< pq::pipeline >( pq::pipeline::private_key(), m_connection );
+   }
+
 }  // namespace tao::pq
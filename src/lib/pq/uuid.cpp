@@ -0,0 +1,52 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include <tao/pq/uuid.hpp>
+
+#include <stdexcept>
+
+#include <tao/pq/internal/hex.hpp>
+
+namespace tao::pq
+{
+   auto uuid::from_string( const std::string_view value ) -> uuid
+   {
+      std::string_view digits = value;
+      if( ( digits.size() >= 2 ) && ( digits.front() == '{' ) && ( digits.back() == '}' ) ) {
+         digits.remove_prefix( 1 );
+         digits.remove_suffix( 1 );
+      }
+      uuid nrv;
+      std::size_t n = 0;
+      for( std::size_t i = 0; i < digits.size(); ++i ) {
+         if( ( digits[ i ] == '-' ) && ( n != 0 ) && ( n % 4 == 0 ) && ( n != 32 ) && ( digits[ i - 1 ] != '-' ) ) {
+            continue;
+         }
+         const int v = internal::hex_value( digits[ i ] );
+         if( ( v < 0 ) || ( n == 32 ) ) {
+            throw std::invalid_argument( "invalid value in tao::pq::uuid for input: " + std::string( value ) );
+         }
+         nrv.bytes[ n / 2 ] = static_cast< unsigned char >( ( n % 2 == 0 ) ? ( v << 4 ) : ( nrv.bytes[ n / 2 ] | v ) );
+         ++n;
+      }
+      if( n != 32 ) {
+         throw std::invalid_argument( "invalid value in tao::pq::uuid for input: " + std::string( value ) );
+      }
+      return nrv;
+   }
+
+   auto uuid::to_string() const -> std::string
+   {
+      std::string nrv( 36, '-' );
+      std::size_t p = 0;
+      for( std::size_t i = 0; i < bytes.size(); ++i ) {
+         if( ( i == 4 ) || ( i == 6 ) || ( i == 8 ) || ( i == 10 ) ) {
+            ++p;
+         }
+         nrv[ p++ ] = internal::hex_digits[ bytes[ i ] >> 4 ];
+         nrv[ p++ ] = internal::hex_digits[ bytes[ i ] & 0x0F ];
+      }
+      return nrv;
+   }
+
+}  // namespace tao::pq
@@ -2,6 +2,7 @@
 // Please see LICENSE for license or visit https://github.com/taocpp/taopq/
 
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 #include <limits>
@@ -12,6 +13,10 @@
 #include "../macros.hpp"
 
 #include <tao/pq/connection.hpp>
+#include <tao/pq/decimal.hpp>
+#include <tao/pq/inet.hpp>
+#include <tao/pq/macaddr.hpp>
+#include <tao/pq/uuid.hpp>
 
 std::shared_ptr< tao::pq::connection > connection;
 
@@ -92,10 +97,35 @@ void check_null( const std::string& datatype )
    TEST_ASSERT( result[ 0 ][ 0 ].is_null() );
 }
 
+// the types without an operator<< are printed as their text format or their count
+template< typename T >
+auto printable( const T& value, int /*unused*/ ) -> decltype( value.to_string() )
+{
+   return value.to_string();
+}
+
+template< typename Rep, typename Period >
+auto printable( const std::chrono::duration< Rep, Period >& value, int /*unused*/ ) -> Rep
+{
+   return value.count();
+}
+
+template< typename Clock, typename Duration >
+auto printable( const std::chrono::time_point< Clock, Duration >& value, int /*unused*/ )
+{
+   return value.time_since_epoch().count();
+}
+
+template< typename T >
+auto printable( const T& value, long /*unused*/ ) -> const T&
+{
+   return value;
+}
+
 template< typename T >
 void check( const std::string& datatype, const T& value )
 {
-   std::cout << "check: " << datatype << " value: " << value << std::endl;
+   std::cout << "check: " << datatype << " value: " << printable( value, 0 ) << std::endl;
    if( prepare_datatype( datatype ) ) {
       TEST_ASSERT( connection->execute( "INSERT INTO tao_basic_datatypes_test VALUES ( $1 )", value ).rows_affected() == 1 );
    }
@@ -105,7 +135,7 @@ void check( const std::string& datatype, const T& value )
    const auto result = connection->execute( "SELECT * FROM tao_basic_datatypes_test" );
    if( value == value ) {  // NOLINT(misc-redundant-expression)
       if( result[ 0 ][ 0 ].as< T >() != value ) {
-         std::cout << "check: " << datatype << " value: " << value << " result: " << result.get( 0, 0 ) << " FAILED!" << std::endl;
+         std::cout << "check: " << datatype << " value: " << printable( value, 0 ) << " result: " << result.get( 0, 0 ) << " FAILED!" << std::endl;
          TEST_ASSERT( false );
       }
    }
@@ -115,6 +145,24 @@ void check( const std::string& datatype, const T& value )
    }
 }
 
+// like check(), but the value is sent as a binary parameter and received in binary format
+template< typename T >
+void check_binary( const std::string& datatype, const T& value )
+{
+   std::cout << "check binary: " << datatype << " value: " << printable( value, 0 ) << std::endl;
+   if( prepare_datatype( datatype ) ) {
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "INSERT INTO tao_basic_datatypes_test VALUES ( $1 )", value ).rows_affected() == 1 );
+   }
+   else {
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "UPDATE tao_basic_datatypes_test SET a=$1", value ).rows_affected() == 1 );
+   }
+   const auto result = connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT * FROM tao_basic_datatypes_test" );
+   if( result[ 0 ][ 0 ].as< T >() != value ) {
+      std::cout << "check binary: " << datatype << " value: " << printable( value, 0 ) << " FAILED!" << std::endl;
+      TEST_ASSERT( false );
+   }
+}
+
 template< typename T >
 auto check( const std::string& datatype )
    -> std::enable_if_t< std::is_signed_v< T > >
@@ -440,6 +488,144 @@ void run()
    check< std::string >( "TEXT", "äöüÄÖÜß€𝄞" );
    check< std::string >( "TEXT", "ä\tö\nü\1Ä\"Ö;Ü'ß#€𝄞" );
 
+   // unsigned values are sent as the next wider signed type in binary format, 64 bit values as NUMERIC
+   check_binary< unsigned char >( "SMALLINT", 200 );
+   check_binary< unsigned short >( "INTEGER", 65535 );
+   check_binary< unsigned >( "BIGINT", 4000000000U );
+   {
+      const auto max = std::numeric_limits< unsigned long long >::max();
+#if defined( __SIZEOF_INT128__ )
+      check_binary< unsigned long long >( "NUMERIC", max );
+#else
+      TEST_THROWS( check_binary< unsigned long long >( "NUMERIC", max ) );
+#endif
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "SELECT $1::TEXT", max ).as< std::string >() == "18446744073709551615" );
+      TEST_THROWS( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1", max ).as< long long >() );
+   }
+
+   // integral values are received from NUMERIC without fractional digits in binary format
+   check_binary< int >( "NUMERIC", 42 );
+   check_binary< int >( "NUMERIC(5,2)", 0 );
+   check_binary< int >( "NUMERIC(5,2)", 100 );
+   TEST_THROWS( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT 1.5::NUMERIC" ).as< int >() );
+
+   check_null( "NUMERIC" );
+   check< tao::pq::decimal >( "NUMERIC", tao::pq::decimal::from_string( "-12345.678" ) );
+   check< tao::pq::decimal >( "NUMERIC", { 1250, 2 } );
+   check< tao::pq::decimal >( "NUMERIC", { 0, 2 } );
+   check_binary< tao::pq::decimal >( "NUMERIC", { -12345678, 3 } );
+   check_binary< tao::pq::decimal >( "NUMERIC", { 1, 30 } );
+   check_binary< tao::pq::decimal >( "NUMERIC", { 0, 2 } );
+   TEST_ASSERT( tao::pq::decimal::from_string( "-12345.678" ) == ( tao::pq::decimal{ -12345678, 3 } ) );
+   TEST_ASSERT( ( tao::pq::decimal{ -12345678, 3 } ).to_string() == "-12345.678" );
+   TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1 - 0.0005", tao::pq::decimal{ -12345678, 3 } ).as< tao::pq::decimal >().to_string() == "-12345.6785" );
+   TEST_THROWS( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT 'NaN'::NUMERIC" ).as< tao::pq::decimal >() );
+   TEST_THROWS( connection->execute( "SELECT 'NaN'::NUMERIC" ).as< tao::pq::decimal >() );
+   TEST_THROWS( tao::pq::decimal::from_string( "1.2.3" ) );
+   TEST_THROWS( tao::pq::decimal::from_string( "" ) );
+
+   {
+      using namespace std::chrono_literals;
+      using days = std::chrono::duration< int, std::ratio< 86400 > >;
+      using date = std::chrono::time_point< std::chrono::system_clock, days >;
+      using micro_time_point = std::chrono::time_point< std::chrono::system_clock, std::chrono::microseconds >;
+      const micro_time_point ts( 1591700000123456us );
+      const date d( days( 18422 ) );
+
+      check_null( "TIMESTAMPTZ" );
+      check< micro_time_point >( "TIMESTAMPTZ", ts );
+      check_binary< micro_time_point >( "TIMESTAMPTZ", ts );
+      check< micro_time_point >( "TIMESTAMP", ts );
+      check_null( "DATE" );
+      check< date >( "DATE", d );
+      check< date >( "DATE", date( days( -735160 ) ) );
+      check_binary< date >( "DATE", d );
+      check_null( "INTERVAL" );
+      check< std::chrono::seconds >( "INTERVAL", -90061s );
+      check< std::chrono::milliseconds >( "INTERVAL", 93784500ms );
+      check_binary< std::chrono::milliseconds >( "INTERVAL", -90061500ms );
+      check_null( "TIME" );
+      check< std::chrono::minutes >( "TIME", 754min );
+
+      TEST_ASSERT( connection->execute( "SELECT ( $1 AT TIME ZONE 'UTC' )::TEXT", ts ).as< std::string >() == "2020-06-09 10:53:20.123456" );
+      TEST_ASSERT( connection->execute( "SELECT '2020-06-09 12:53:20.123456+02'::TIMESTAMPTZ" ).as< micro_time_point >() == ts );
+      TEST_ASSERT( connection->execute( "SELECT '2020-06-09 10:53:20.9'::TIMESTAMP" ).as< std::chrono::time_point< std::chrono::system_clock, std::chrono::seconds > >().time_since_epoch() == 1591700000s );
+      TEST_ASSERT( connection->execute( "SELECT '0044-03-15 BC'::DATE" ).as< date >() == date( days( -735160 ) ) );
+      TEST_ASSERT( connection->execute( "SELECT '1 day 02:03:04.5'::INTERVAL" ).as< std::chrono::milliseconds >() == 93784500ms );
+      TEST_THROWS( connection->execute( "SELECT '1 month'::INTERVAL" ).as< std::chrono::seconds >() );
+      TEST_THROWS( connection->execute( "SELECT '1000000:00:00'::INTERVAL" ).as< std::chrono::duration< int > >() );
+      TEST_THROWS( connection->execute( "SELECT '100000000:00:00'::INTERVAL" ).as< std::chrono::duration< int, std::ratio< 60 > > >() );
+      TEST_THROWS( connection->execute( "SELECT 'infinity'::TIMESTAMP" ).as< micro_time_point >() );
+
+      const auto binary = [ & ]( const char* statement, const auto& value ) {
+         return connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( statement, value );
+      };
+      TEST_ASSERT( binary( "SELECT $1 AT TIME ZONE 'UTC'", ts ).as< micro_time_point >() == ts );
+      TEST_ASSERT( binary( "SELECT $1::TIMESTAMP", d ).as< micro_time_point >() == micro_time_point( d ) );
+      TEST_ASSERT( binary( "SELECT $1::TEXT", d ).as< std::string >() == "2020-06-09" );
+      TEST_ASSERT( binary( "SELECT $1::TEXT", 26h ).as< std::string >() == "26:00:00" );
+      TEST_ASSERT( binary( "SELECT $1 + '1 day'::INTERVAL", 1h ).as< std::chrono::hours >() == 25h );
+      TEST_ASSERT( binary( "SELECT $1::TIME", 754min ).as< std::chrono::minutes >() == 754min );
+      TEST_THROWS( binary( "SELECT $1 + '1 year'::INTERVAL", 1h ).as< std::chrono::hours >() );
+      TEST_THROWS( binary( "SELECT $1 * 1000000", 1h ).as< std::chrono::duration< int > >() );
+      TEST_THROWS( binary( "SELECT $1::BIGINT", 42 ).as< std::chrono::microseconds >() );
+      TEST_THROWS( binary( "SELECT $1 + '-infinity'::DATE", 0 ).as< date >() );
+#if defined( TAO_PQ_USE_CALENDAR )
+      const std::chrono::year_month_day ymd = 2020y / 6 / 9;
+      TEST_ASSERT( connection->execute( "SELECT $1", ymd ).as< std::chrono::year_month_day >() == ymd );
+      TEST_ASSERT( binary( "SELECT $1", ymd ).as< std::chrono::year_month_day >() == ymd );
+      TEST_THROWS( connection->execute( "SELECT $1", 2020y / 2 / 30 ) );
+#endif
+   }
+
+   {
+      const auto id = tao::pq::uuid::from_string( "a0eebc99-9c0b-4ef8-bb6d-6bb9bd380a11" );
+      check_null( "UUID" );
+      check< tao::pq::uuid >( "UUID", id );
+      check_binary< tao::pq::uuid >( "UUID", id );
+      TEST_ASSERT( tao::pq::uuid::from_string( "{A0EEBC99-9C0B4EF8-BB6D6BB9-BD380A11}" ) == id );
+      TEST_ASSERT( connection->execute( "SELECT $1::TEXT", id ).as< std::string >() == "a0eebc99-9c0b-4ef8-bb6d-6bb9bd380a11" );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1 < 'b0eebc99-9c0b-4ef8-bb6d-6bb9bd380a11'::UUID", id ).as< bool >() );
+      TEST_THROWS( tao::pq::uuid::from_string( "a0eebc99-9c0b-4ef8-bb6d-6bb9bd380a1" ) );
+      TEST_THROWS( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT 'a0eebc99-9c0b-4ef8-bb6d-6bb9bd380a11'" ).as< tao::pq::uuid >() );
+      TEST_THROWS( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT decode( 'a0eebc999c0b4ef8bb6d6bb9bd380a11', 'hex' )" ).as< tao::pq::uuid >() );
+   }
+
+   {
+      const auto mac = tao::pq::macaddr::from_string( "0800.2b01.0203" );
+      check_null( "MACADDR" );
+      check< tao::pq::macaddr >( "MACADDR", mac );
+      check_binary< tao::pq::macaddr >( "MACADDR", mac );
+      TEST_ASSERT( mac.to_string() == "08:00:2b:01:02:03" );
+      TEST_THROWS( tao::pq::macaddr::from_string( "08:00-2b:01:02:03" ) );
+      TEST_THROWS( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT decode( '08002b010203', 'hex' )" ).as< tao::pq::macaddr >() );
+   }
+
+   {
+      const auto host = tao::pq::inet::from_string( "192.168.0.1/24" );
+      const auto v6 = tao::pq::inet::from_string( "2001:db8:0:0:1::1" );
+      const auto network = tao::pq::cidr::from_string( "192.168.0.0/24" );
+      check_null( "INET" );
+      check< tao::pq::inet >( "INET", host );
+      check< tao::pq::inet >( "INET", v6 );
+      check_binary< tao::pq::inet >( "INET", host );
+      check_binary< tao::pq::inet >( "INET", v6 );
+      check_null( "CIDR" );
+      check< tao::pq::cidr >( "CIDR", network );
+      check_binary< tao::pq::cidr >( "CIDR", network );
+      TEST_ASSERT( v6.to_string() == "2001:db8::1:0:0:1" );
+      TEST_ASSERT( connection->execute( "SELECT host( $1 )", v6 ).as< std::string >() == v6.to_string() );
+      TEST_ASSERT( connection->execute( "SELECT '::ffff:10.0.0.1'::INET" ).as< tao::pq::inet >().to_string() == "::ffff:10.0.0.1" );
+      TEST_ASSERT( connection->execute( "SELECT network( $1 )", host ).as< tao::pq::cidr >() == network );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1 >> '192.168.0.77'::INET", network ).as< bool >() );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT network( $1 )", host ).as< tao::pq::cidr >() == network );
+      TEST_THROWS( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1", host ).as< tao::pq::cidr >() );
+      TEST_THROWS( connection->execute( "SELECT $1", tao::pq::cidr{ host } ) );
+      TEST_THROWS( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT decode( '02180004c0a80001', 'hex' )" ).as< tao::pq::inet >() );
+      TEST_THROWS( tao::pq::inet::from_string( "1:::2" ) );
+      TEST_THROWS( tao::pq::inet::from_string( "10.0.0.1/33" ) );
+   }
+
    // use std::span / tao::span to pass binary data as parameters (works for char, signed char, unsigned char, and std::byte)
 
 #if defined( __clang__ ) && ( __clang_major__ <= 5 )
@@ -5,6 +5,7 @@
 #include "../macros.hpp"
 
 #include <tao/pq/connection.hpp>
+#include <tao/pq/internal/poll.hpp>
 
 void run()
 {
@@ -29,6 +30,24 @@ void run()
    // open a seconds, independent connection (and discard it immediately)
    (void)tao::pq::connection::create( connection_string );
 
+   // open a connection without blocking
+   {
+      const auto async_connection = tao::pq::connection::create_async( connection_string );
+      TEST_ASSERT( !async_connection->is_open() );
+      auto status = tao::pq::poll_status::wait_writable;
+      while( status != tao::pq::poll_status::ready ) {
+         TEST_ASSERT( tao::pq::internal::poll( async_connection->socket(), status ) );
+         status = async_connection->connect_poll();
+      }
+      TEST_ASSERT( async_connection->is_open() );
+      TEST_ASSERT( async_connection->connect_poll() == tao::pq::poll_status::ready );
+      TEST_ASSERT( async_connection->execute( "SELECT 42" ).as< int >() == 42 );
+   }
+
+   // errors are reported when the connection is started or while it is polled
+   TEST_THROWS( tao::pq::connection::create_async( "=" ) );
+   TEST_THROWS_MESSAGE( "THROWS async connection to dbname=DOES_NOT_EXIST", const auto c = tao::pq::connection::create_async( "dbname=DOES_NOT_EXIST" ); auto status = tao::pq::poll_status::wait_writable; while( status != tao::pq::poll_status::ready ) { (void)tao::pq::internal::poll( c->socket(), status ); status = c->connect_poll(); } );
+
    // execute an SQL statement
    connection->execute( "DROP TABLE IF EXISTS tao_connection_test" );
 
@@ -68,6 +87,18 @@ void run()
    // deallocate must get a valid name
    TEST_THROWS( connection->deallocate( "FOO BAR" ) );
 
+   // a prepared statement can be executed through its handle, parameter types can be declared
+   {
+      const auto ps = connection->prepare( "select_typed", "SELECT $1 || $2", { 25, 25 } );
+      TEST_ASSERT( ps.name() == "select_typed" );
+      TEST_ASSERT( ps.types().size() == 2 );
+      TEST_ASSERT( connection->execute( ps, 4, 2 ).as< std::string >() == "42" );
+      TEST_ASSERT( connection->transaction()->execute( ps, "a", "b" ).as< std::string >() == "ab" );
+      TEST_ASSERT( connection->async_execute( ps, "c", "d" ).get().as< std::string >() == "cd" );
+      TEST_EXECUTE( connection->deallocate( ps ) );
+      TEST_THROWS( connection->execute( ps, 4, 2 ) );
+   }
+
    // create a test table
    connection->execute( "CREATE TABLE tao_connection_test ( a INTEGER PRIMARY KEY, b INTEGER )" );
 
@@ -82,6 +113,99 @@ void run()
 
    // read data
    TEST_ASSERT( connection->execute( "SELECT b FROM tao_connection_test WHERE a = 1" )[ 0 ][ 0 ].get() == std::string( "42" ) );
+
+   // execute statements asynchronously on two connections at the same time
+   {
+      const auto connection2 = tao::pq::connection::create( connection_string );
+      auto r1 = connection->async_execute( "SELECT b FROM tao_connection_test WHERE a = $1", 1 );
+      auto r2 = connection2->async_execute( "SELECT pg_sleep( 0.1 ), 43" );
+      TEST_THROWS( connection->execute( "SELECT 42" ) );
+      while( r1.poll() != tao::pq::poll_status::ready ) {
+         TEST_ASSERT( tao::pq::internal::poll( r1.socket(), r1.status() ) );
+      }
+      TEST_ASSERT( r1.get().as< int >() == 42 );
+      TEST_THROWS( r1.get() );
+      TEST_ASSERT( r2.get()[ 0 ].get< int >( 1 ) == 43 );
+   }
+
+   // errors are reported when the result is retrieved
+   TEST_THROWS( connection->async_execute( "FOO BAR BAZ" ).get() );
+
+   // an abandoned async result does not block the connection
+   (void)connection->async_execute( "SELECT 42" );
+   TEST_ASSERT( connection->execute( "SELECT 1" ).as< int >() == 1 );
+
+   // statements are prepared automatically after being executed a few times
+   {
+      const auto c = tao::pq::connection::create( connection_string );
+      const auto prepared = [ & ] { return c->execute( "SELECT COUNT(*) FROM pg_prepared_statements" ).as< std::size_t >(); };
+      TEST_THROWS( c->set_auto_prepare( 2, 0 ) );
+      TEST_EXECUTE( c->set_auto_prepare( 2, 3 ) );
+      TEST_ASSERT( c->execute( "SELECT $1::INTEGER", 1 ).as< int >() == 1 );
+      TEST_ASSERT( c->execute( "SELECT $1::INTEGER", 2 ).as< int >() == 2 );
+      TEST_ASSERT( prepared() == 0 );
+      TEST_ASSERT( c->execute( "SELECT $1::INTEGER", 3 ).as< int >() == 3 );
+      TEST_ASSERT( c->execute( "SELECT $1::INTEGER", 4 ).as< int >() == 4 );
+      TEST_ASSERT( prepared() == 1 );
+
+      // the least recently used statements are deallocated
+      for( int i = 0; i < 3; ++i ) {
+         TEST_EXECUTE( c->execute( "SELECT $1::TEXT", "foo" ) );
+         TEST_EXECUTE( c->execute( "SELECT $1::BIGINT", 42 ) );
+      }
+      TEST_ASSERT( prepared() == 1 );
+
+      // invalid statements are still reported
+      for( int i = 0; i < 4; ++i ) {
+         TEST_THROWS( c->execute( "FOO BAR BAZ" ) );
+      }
+
+      TEST_EXECUTE( c->set_auto_prepare( 0 ) );
+      TEST_ASSERT( prepared() == 0 );
+
+      // statements dropped inside an aborted transaction are deallocated after it ended
+      TEST_EXECUTE( c->set_auto_prepare( 1, 1 ) );
+      {
+         const auto tr = c->transaction();
+         TEST_ASSERT( tr->execute( "SELECT $1::INTEGER", 1 ).as< int >() == 1 );
+         TEST_THROWS( tr->execute( "FOO BAR BAZ" ) );
+         TEST_EXECUTE( c->set_auto_prepare( 0 ) );
+      }
+      TEST_ASSERT( prepared() == 0 );
+
+      // async statements use prepared statements, but only synchronous statements prepare or deallocate them
+      {
+         // a statement which starts with a parenthesis is never prepared automatically itself
+         const auto count = [ & ] { return c->execute( "( SELECT COUNT(*) FROM pg_prepared_statements )" ).as< std::size_t >(); };
+         TEST_EXECUTE( c->set_auto_prepare( 1, 1 ) );
+         TEST_ASSERT( c->async_execute( "SELECT $1::INTEGER", 1 ).get().as< int >() == 1 );
+         TEST_ASSERT( count() == 0 );
+         TEST_ASSERT( c->execute( "SELECT $1::INTEGER", 2 ).as< int >() == 2 );
+         TEST_ASSERT( count() == 1 );
+         TEST_ASSERT( c->async_execute( "SELECT $1::INTEGER", 3 ).get().as< int >() == 3 );
+         TEST_ASSERT( c->async_execute( "SELECT $1::TEXT", "foo" ).get().as< std::string >() == "foo" );
+         TEST_ASSERT( count() == 0 );
+         TEST_EXECUTE( c->set_auto_prepare( 0 ) );
+      }
+   }
+
+   // LISTEN/NOTIFY
+   {
+      const auto c = tao::pq::connection::create( connection_string );
+      TEST_ASSERT( !c->get_notification() );
+      TEST_EXECUTE( c->listen( "Tao Channel" ) );
+      TEST_EXECUTE( c->notify( "Tao Channel", "hello" ) );
+      TEST_EXECUTE( c->notify( "tao channel", "ignored" ) );
+      const auto n = c->get_notification();
+      TEST_ASSERT( n );
+      TEST_ASSERT( n->channel() == std::string( "Tao Channel" ) );
+      TEST_ASSERT( n->payload() == std::string( "hello" ) );
+      TEST_ASSERT( n->pid() > 0 );
+      TEST_ASSERT( !c->get_notification() );
+      TEST_EXECUTE( c->unlisten( "Tao Channel" ) );
+      TEST_EXECUTE( c->notify( "Tao Channel" ) );
+      TEST_ASSERT( !c->get_notification() );
+   }
 }
 
 auto main() -> int
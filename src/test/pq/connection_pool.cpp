@@ -25,6 +25,13 @@ void run()
    TEST_ASSERT( pool2->connection()->execute( "SELECT 4" ).as< int >() == 4 );
    TEST_ASSERT( conn->execute( "SELECT 5" ).as< int >() == 5 );
    TEST_ASSERT( pool2->connection()->execute( "SELECT 6" ).as< int >() == 6 );
+
+   const auto pool3 = tao::pq::connection_pool::create( connection_string );
+   TEST_EXECUTE( pool3->warm_up( 4 ) );
+   TEST_ASSERT( pool3->connection()->execute( "SELECT 7" ).as< int >() == 7 );
+
+   const auto pool4 = tao::pq::connection_pool::create( "dbname=DOES_NOT_EXIST" );
+   TEST_THROWS( pool4->warm_up( 2 ) );
 }
 
 auto main() -> int  // NOLINT(bugprone-exception-escape)
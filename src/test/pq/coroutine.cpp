@@ -0,0 +1,120 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/coroutine.hpp>
+#include <tao/pq/event_loop.hpp>
+
+#if defined( TAO_PQ_USE_COROUTINES )
+
+#include <exception>
+#include <memory>
+#include <vector>
+
+// a minimal eagerly started coroutine type, applications bring their own
+struct task
+{
+   struct promise_type
+   {
+      auto get_return_object() noexcept -> task
+      {
+         return {};
+      }
+
+      auto initial_suspend() noexcept -> std::suspend_never
+      {
+         return {};
+      }
+
+      auto final_suspend() noexcept -> std::suspend_never
+      {
+         return {};
+      }
+
+      void return_void() noexcept {}
+
+      void unhandled_exception() noexcept
+      {
+         std::terminate();
+      }
+   };
+};
+
+auto query( const std::shared_ptr< tao::pq::connection_pool > pool, const int i, int& out ) -> task
+{
+   const auto connection = co_await pool->async_connection();
+   const auto tr = connection->transaction();
+   const auto r = co_await tr->async_execute( "SELECT pg_sleep( 0.1 ), $1::INTEGER", i );
+   co_await tr->async_commit();
+   out = r[ 0 ][ 1 ].as< int >();
+}
+
+auto failure( const std::shared_ptr< tao::pq::connection > connection, bool& caught ) -> task
+{
+   try {
+      (void)co_await connection->async_execute( "FOO BAR BAZ" );
+   }
+   catch( const std::exception& ) {
+      caught = true;
+   }
+}
+
+void run()
+{
+   const auto pool = tao::pq::connection_pool::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+
+   // all coroutines wait concurrently, driven by a single thread
+   {
+      std::vector< int > results( 8, -1 );
+      tao::pq::event_loop loop;
+      for( int i = 0; i < 8; ++i ) {
+         loop.post( [ &, i ] { query( pool, i, results[ i ] ); } );
+      }
+      TEST_EXECUTE( loop.run() );
+      TEST_ASSERT( loop.empty() );
+      for( int i = 0; i < 8; ++i ) {
+         TEST_ASSERT( results[ i ] == i );
+      }
+   }
+
+   // without a current scheduler, co_await blocks
+   {
+      int result = -1;
+      query( pool, 42, result );
+      TEST_ASSERT( result == 42 );
+   }
+
+   // errors are reported when the coroutine resumes
+   {
+      bool caught = false;
+      failure( pool->connection(), caught );
+      TEST_ASSERT( caught );
+   }
+}
+
+#else
+
+void run()
+{
+   std::cout << "coroutines not available, skipping tests" << std::endl;
+}
+
+#endif
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+}
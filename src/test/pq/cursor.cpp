@@ -0,0 +1,71 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/cursor.hpp>
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+
+   {
+      const auto tr = connection->transaction();
+      const auto c = tr->cursor( 100, "SELECT i FROM generate_series( 1, $1 ) AS i", 1050 );
+      TEST_ASSERT( c->fetch_size() == 100 );
+      int count = 0;
+      for( const auto& row : *c ) {
+         ++count;
+         TEST_ASSERT( row.get< int >( 0 ) == count );
+      }
+      TEST_ASSERT( count == 1050 );
+      TEST_EXECUTE( c->close() );
+      TEST_EXECUTE( tr->commit() );
+   }
+
+   {
+      // a multiple of the fetch size ends with an empty batch
+      const auto tr = connection->transaction();
+      int count = 0;
+      tr->cursor( 10, "SELECT * FROM generate_series( 1, 100 )" )->for_each( [ & ]( const tao::pq::row& /*unused*/ ) { ++count; } );
+      TEST_ASSERT( count == 100 );
+   }
+
+   {
+      // in autocommit mode, the cursor is declared WITH HOLD
+      const auto c = connection->cursor( 7, "SELECT * FROM generate_series( 1, 20 )" );
+      int sum = 0;
+      c->for_each( [ & ]( const tao::pq::row& row ) { sum += row.as< int >(); } );
+      TEST_ASSERT( sum == 210 );
+   }
+
+   {
+      // an abandoned cursor is closed, including an outstanding batch
+      const auto tr = connection->transaction();
+      {
+         const auto c = tr->cursor( 10, "SELECT * FROM generate_series( 1, 100 )" );
+         TEST_ASSERT( ( *c->begin() ).as< int >() == 1 );
+      }
+      TEST_ASSERT( tr->execute( "SELECT 42" ).as< int >() == 42 );
+   }
+
+   TEST_THROWS( (void)connection->transaction()->cursor( 0, "SELECT 42" ) );
+   TEST_THROWS( (void)connection->transaction()->cursor( 10, "FOO BAR BAZ" ) );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+}
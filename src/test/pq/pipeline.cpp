@@ -0,0 +1,75 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/pipeline.hpp>
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+
+   connection->execute( "DROP TABLE IF EXISTS tao_pipeline_test" );
+   connection->execute( "CREATE TABLE tao_pipeline_test ( a INTEGER PRIMARY KEY, b INTEGER )" );
+
+   {
+      const auto tr = connection->transaction();
+      const auto pl = tr->pipeline();
+
+      // the parent transaction is blocked while the pipeline is active
+      TEST_THROWS( tr->execute( "SELECT 42" ) );
+      TEST_THROWS( (void)tr->pipeline() );
+
+      const auto r1 = pl->enqueue( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 1, 42 );
+      const auto r2 = pl->enqueue( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 2, 43 );
+      const auto r3 = pl->enqueue( "SELECT b FROM tao_pipeline_test WHERE a = $1", 2 );
+      pl->sync();
+      const auto r4 = pl->enqueue( "SELECT COUNT(*) FROM tao_pipeline_test" );
+
+      // results can be retrieved in any order
+      TEST_ASSERT( r3.get().as< int >() == 43 );
+      TEST_ASSERT( r1.get().rows_affected() == 1 );
+      TEST_THROWS( r1.get() );
+      TEST_ASSERT( r4.get().as< int >() == 2 );
+      TEST_EXECUTE( pl->finish() );
+
+      // the result of an unclaimed statement remains available
+      TEST_ASSERT( r2.get().rows_affected() == 1 );
+
+      TEST_EXECUTE( tr->commit() );
+   }
+   TEST_ASSERT( connection->execute( "SELECT * FROM tao_pipeline_test" ).size() == 2 );
+
+   {
+      const auto pl = connection->pipeline();
+      const auto r1 = pl->enqueue( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 1, 44 );  // fails
+      const auto r2 = pl->enqueue( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 3, 45 );  // aborted
+      pl->sync();
+      const auto r3 = pl->enqueue( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 4, 46 );
+      TEST_EXECUTE( pl->finish() );
+      TEST_THROWS( r1.get() );
+      TEST_THROWS( r2.get() );
+      TEST_ASSERT( r3.get().rows_affected() == 1 );
+   }
+   TEST_ASSERT( connection->execute( "SELECT * FROM tao_pipeline_test" ).size() == 3 );
+
+   // the connection is usable again once the pipeline is gone
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+}
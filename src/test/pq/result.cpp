@@ -5,10 +5,33 @@
 #include "../macros.hpp"
 
 #include <tao/pq/connection.hpp>
+#include <tao/pq/result_traits_array.hpp>
 #include <tao/pq/result_traits_optional.hpp>
 #include <tao/pq/result_traits_pair.hpp>
+#include <tao/pq/result_traits_struct.hpp>
 #include <tao/pq/result_traits_tuple.hpp>
 
+static_assert( tao::pq::internal::has_reserve< std::vector< int > > );
+static_assert( tao::pq::internal::has_reserve< std::unordered_set< int > > );
+static_assert( !tao::pq::internal::has_reserve< std::list< int > > );
+static_assert( !tao::pq::internal::has_reserve< std::set< int > > );
+
+struct user
+{
+   int id = 0;
+   std::string name;
+   std::optional< std::string > email;
+};
+
+template<>
+struct tao::pq::result_members< user >
+{
+   static constexpr auto members = std::make_tuple( tao::pq::member( "id", &user::id ), tao::pq::member( "name", &user::name ), tao::pq::member( "email", &user::email ) );
+};
+
+static_assert( tao::pq::result_traits_size< user > == 3 );
+static_assert( tao::pq::result_traits_has_bind< user > );
+
 void run()  // NOLINT(readability-function-size)
 {
    const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
@@ -70,6 +93,71 @@ void run()  // NOLINT(readability-function-size)
    TEST_ASSERT( connection->execute( "SELECT 1, 2" ).unordered_multimap< int, int >().size() == 1 );
 
    TEST_ASSERT( connection->execute( "SELECT 1 UNION ALL SELECT 2" ).list< int >().size() == 2 );
+   TEST_ASSERT( connection->execute( "SELECT generate_series( 1, 100 )" ).vector< int >().capacity() == 100 );
+   TEST_THROWS( connection->execute( "SELECT 1 UNION ALL SELECT NULL" ).vector< int >() );
+   {
+      const auto series = connection->execute( "SELECT i, i::TEXT FROM generate_series( 1, 100000 ) AS i" );
+      TEST_ASSERT( series.parallel_vector< std::tuple< int, std::string > >( 4 ) == series.vector< std::tuple< int, std::string > >() );
+      TEST_ASSERT( series.parallel_vector< int >().size() == 100000 );
+      TEST_ASSERT( series.parallel_vector< int >( 1 ).size() == 100000 );
+   }
+   TEST_THROWS( connection->execute( "SELECT NULLIF( i, 99999 ) FROM generate_series( 1, 100000 ) AS i" ).parallel_vector< int >( 4 ) );
+   TEST_ASSERT( connection->execute( "SELECT 42" ).parallel_vector< int >( 4 ) == std::vector< int >{ 42 } );
+
+   TEST_ASSERT( connection->execute( "SELECT 'Hallo'" ).as< std::string_view >() == "Hallo" );
+   TEST_ASSERT( connection->execute( "SELECT ''" ).as< std::string_view >().empty() );
+   TEST_ASSERT( !connection->execute( "SELECT NULL::TEXT" ).as< std::optional< std::string_view > >() );
+   TEST_THROWS( connection->execute( "SELECT NULL::TEXT" )[ 0 ][ 0 ].view() );
+   {
+      const auto text = connection->execute( "SELECT repeat( 'x', 100000 ), '{\"a\":1}'::JSON" );
+      TEST_ASSERT( text[ 0 ][ 0 ].view().size() == 100000 );
+      TEST_ASSERT( text[ 0 ][ 0 ].view().data() == text.get( 0, 0 ) );
+      TEST_ASSERT( text[ 0 ][ 1 ].view() == "{\"a\":1}" );
+      TEST_ASSERT( text.column< std::string_view >( 1 ).values[ 0 ] == "{\"a\":1}" );
+      TEST_ASSERT( text[ 0 ].get< std::string >( 1 ) == "{\"a\":1}" );
+   }
+   TEST_ASSERT( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT 'Hallo'::TEXT" )[ 0 ][ 0 ].view() == "Hallo" );
+
+   {
+      const auto original = connection->execute( "SELECT i AS a, NULLIF( i % 2, 0 ) AS \"B\", repeat( 'x', i ) FROM generate_series( 0, 99 ) AS i" );
+      TEST_ASSERT( !original.is_snapshot() );
+      const auto snapshot = original.snapshot();
+      TEST_ASSERT( snapshot.is_snapshot() );
+      TEST_ASSERT( snapshot.underlying_raw_ptr() == nullptr );
+      TEST_ASSERT( snapshot.size() == 100 );
+      TEST_ASSERT( snapshot.columns() == 3 );
+      TEST_ASSERT( snapshot.name( 1 ) == "B" );
+      TEST_ASSERT( snapshot.index( "\"B\"" ) == 1 );
+      TEST_THROWS( snapshot.index( "b" ) );
+      TEST_ASSERT( snapshot.rows_affected() == 100 );
+      TEST_ASSERT( snapshot.is_null( 0, 1 ) );
+      TEST_THROWS( snapshot.get( 0, 1 ) );
+      TEST_ASSERT( snapshot.get( 42, 0 ) == std::string( "42" ) );
+      TEST_ASSERT( snapshot.length( 42, 2 ) == 42 );
+      TEST_ASSERT( snapshot[ 7 ][ "a" ].as< int >() == 7 );
+      TEST_ASSERT( snapshot[ 7 ][ 2 ].view() == std::string( 7, 'x' ) );
+      TEST_ASSERT( snapshot.column< int >( 1 ).is_null( 42 ) );
+      using tuple_t = std::tuple< int, std::optional< int >, std::string >;
+      TEST_ASSERT( snapshot.vector< tuple_t >() == original.vector< tuple_t >() );
+
+      const auto data = original.serialize();
+      TEST_ASSERT( data == snapshot.serialize() );
+      const auto copy = tao::pq::result::deserialize( data );
+      TEST_ASSERT( copy.vector< tuple_t >() == original.vector< tuple_t >() );
+      const auto view = tao::pq::result::deserialize( nullptr, data.data(), data.size() );
+      TEST_ASSERT( view.get( 99, 0 ) == std::string( "99" ) );
+
+      TEST_THROWS( tao::pq::result::deserialize( "" ) );
+      TEST_THROWS( tao::pq::result::deserialize( data.substr( 0, data.size() - 1 ) ) );
+      TEST_THROWS( tao::pq::result::deserialize( data + '\0' ) );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 1" ).snapshot().as< int >() == 1 );
+   TEST_ASSERT( connection->execute( "SELECT FROM generate_series( 1, 3 )" ).snapshot().rows_affected() == 3 );
+   TEST_THROWS( connection->execute( "SET search_path TO public" ).snapshot().size() );
+   TEST_ASSERT( connection->execute( "SELECT 1, NULL" ).tuple< int, std::optional< int > >() == std::tuple< int, std::optional< int > >( 1, std::nullopt ) );
+   TEST_THROWS( connection->execute( "SELECT 1" )[ 1 ].get< int >( 0 ) );
+   TEST_THROWS( connection->execute( "SELECT 1" )[ 1 ].optional< int >( 0 ) );
+   TEST_THROWS( connection->execute( "SELECT 1 WHERE FALSE" )[ 0 ].as< int >() );
    TEST_ASSERT( connection->execute( "SELECT 1, 2, 3, 4 UNION ALL SELECT 5, 6, 7, 8" ).list< std::tuple< int, int, int, int > >().size() == 2 );
    TEST_ASSERT( connection->execute( "SELECT 1, 2 UNION ALL SELECT 2, 5 UNION ALL SELECT 3, 42" ).map< int, int >().size() == 3 );
 
@@ -134,11 +222,166 @@ void run()  // NOLINT(readability-function-size)
    TEST_ASSERT( connection->execute( "SELECT 4294967295" ).as< unsigned >() == 4294967295 );
    TEST_THROWS( connection->execute( "SELECT 4294967296" ).as< unsigned >() );
 
+   TEST_ASSERT( !connection->execute( "SELECT 42" ).is_binary( 0 ) );
+   TEST_ASSERT( connection->execute( "SELECT 42" ).length( 0, 0 ) == 2 );
+
+   {
+      const auto binary = connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT 42::INT2, -42::INT4, 42::INT8, 1.5::FLOAT4, 2.5::FLOAT8, TRUE, 'Hallo'::TEXT, NULL::INT4" );
+      TEST_ASSERT( binary.is_binary( 0 ) );
+      TEST_ASSERT( binary.length( 0, 1 ) == 4 );
+      TEST_ASSERT( binary[ 0 ].get< short >( 0 ) == 42 );
+      TEST_ASSERT( binary[ 0 ].get< long long >( 0 ) == 42 );
+      TEST_ASSERT( binary[ 0 ].get< int >( 1 ) == -42 );
+      TEST_THROWS( binary[ 0 ].get< unsigned >( 1 ) );
+      TEST_ASSERT( binary[ 0 ].get< unsigned char >( 2 ) == 42 );
+      TEST_ASSERT( binary[ 0 ].get< double >( 3 ) == 1.5 );
+      TEST_ASSERT( binary[ 0 ].get< float >( 4 ) == 2.5 );
+      TEST_ASSERT( binary[ 0 ].get< bool >( 5 ) );
+      TEST_ASSERT( binary[ 0 ].get< std::string >( 6 ) == "Hallo" );
+      TEST_ASSERT( binary[ 0 ][ 6 ].as< const char* >() == std::string( "Hallo" ) );
+      TEST_ASSERT( !binary[ 0 ].optional< int >( 7 ) );
+      TEST_ASSERT( binary[ 0 ].optional< int >( 1 ) == -42 );
+      TEST_THROWS( binary[ 0 ].get< int >( 3 ) );
+      TEST_THROWS( binary[ 0 ].get< double >( 1 ) );
+      TEST_THROWS( binary[ 0 ].get< bool >( 0 ) );
+   }
+   TEST_THROWS( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT 32768::INT4" ).as< short >() );
+   TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1::INT8", 1764L ).as< long >() == 1764 );
+
+   {
+      const std::vector< int > ids = { 3, 5, 7 };
+      TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM generate_series( 1, 10 ) AS i WHERE i = ANY( $1 )", ids ).as< int >() == 3 );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "SELECT COUNT(*) FROM generate_series( 1, 10 ) AS i WHERE i = ANY( $1 )", ids ).as< int >() == 3 );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "SELECT COUNT(*) FROM generate_series( 1, 10 ) AS i WHERE i = ANY( $1 )", tao::span< const int >( ids ).first( 2 ) ).as< int >() == 2 );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "SELECT $1::TEXT", std::array< long long, 2 >{ 1, -2 } ).as< std::string >() == "{1,-2}" );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "SELECT $1::TEXT", std::vector< int >() ).as< std::string >() == "{}" );
+
+      const std::vector< std::optional< std::string > > strings = { "a", "", std::nullopt, "NULL", "x \"y\"", "{,}" };
+      TEST_ASSERT( connection->execute( "SELECT $1::TEXT[] = ARRAY[ 'a', '', NULL, 'NULL', 'x \"y\"', '{,}' ]::TEXT[]", strings ).as< bool >() );
+      TEST_ASSERT( connection->execute( "SELECT array_length( $1::TEXT[], 1 ), ( $1::TEXT[] )[ 3 ] IS NULL, ( $1::TEXT[] )[ 5 ]", strings ).as< std::tuple< int, bool, std::string > >() == std::make_tuple( 6, true, "x \"y\"" ) );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "SELECT array_length( $1, 1 ), $1[ 3 ] IS NULL, $1[ 5 ]", strings ).as< std::tuple< int, bool, std::string > >() == std::make_tuple( 6, true, "x \"y\"" ) );
+
+      const std::vector< std::vector< short > > matrix = { { 1, 2, 3 }, { 4, 5, 6 } };
+      TEST_ASSERT( connection->execute( "SELECT ( $1::INT2[] )[ 2 ][ 3 ]", matrix ).as< int >() == 6 );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "SELECT array_dims( $1 ), $1[ 2 ][ 3 ]", matrix ).as< std::pair< std::string, int > >() == std::make_pair( std::string( "[1:2][1:3]" ), 6 ) );
+      TEST_THROWS( connection->execute< tao::pq::parameter_binary_traits >( "SELECT $1", std::vector< std::vector< int > >{ { 1 }, { 2, 3 } } ) );
+
+      TEST_ASSERT( connection->execute( "SELECT $1::INT4[]", ids ).as< std::vector< int > >() == ids );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1", ids ).as< std::vector< int > >() == ids );
+      TEST_ASSERT( connection->execute( "SELECT $1::TEXT[]", strings ).as< std::vector< std::optional< std::string > > >() == strings );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1", strings ).as< std::vector< std::optional< std::string > > >() == strings );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1", strings ).as< std::vector< std::optional< std::string_view > > >()[ 4 ] == std::string_view( "x \"y\"" ) );
+      TEST_ASSERT( connection->execute( "SELECT ARRAY[ 'a', 'b c' ]" ).as< std::vector< std::string > >()[ 1 ] == "b c" );
+      TEST_THROWS( connection->execute( "SELECT ARRAY[ 'a', 'b' ]" ).as< std::vector< std::string_view > >() );
+      TEST_ASSERT( connection->execute( "SELECT '{a\\ , b }'::TEXT" ).as< std::vector< std::string > >() == std::vector< std::string >{ "a ", "b" } );
+      TEST_THROWS( connection->execute( "SELECT '{a\\'::TEXT" ).as< std::vector< std::string > >() );
+      TEST_THROWS( connection->execute( "SELECT $1::TEXT[]", strings ).as< std::vector< std::optional< std::string_view > > >() );
+      TEST_THROWS( connection->execute( "SELECT ARRAY[ 1, NULL ]" ).as< std::vector< int > >() );
+      TEST_ASSERT( connection->execute( "SELECT $1::INT2[]", matrix ).as< std::vector< std::vector< short > > >() == matrix );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1", matrix ).as< std::vector< std::vector< short > > >() == matrix );
+      TEST_THROWS( connection->execute< tao::pq::parameter_binary_traits, tao::pq::result_format::binary >( "SELECT $1", matrix ).as< std::vector< short > >() );
+      TEST_ASSERT( connection->execute( "SELECT '[0:1]={7,8}'::INT4[]" ).as< std::vector< int > >() == std::vector< int >{ 7, 8 } );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT '{}'::INT4[]" ).as< std::vector< int > >().empty() );
+      TEST_THROWS( connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT '{1,2}'::TEXT[]" ).as< std::vector< int > >() );
+      TEST_ASSERT( connection->execute( "SELECT array_agg( i ORDER BY i ) FROM generate_series( 1, 1000 ) AS i" ).as< std::vector< long > >().back() == 1000 );
+
+      const std::vector< unsigned char > bytes = { 1, 2, 3 };
+      TEST_ASSERT( connection->execute( "SELECT length( $1::BYTEA )", bytes ).as< int >() == 3 );
+      TEST_ASSERT( connection->execute< tao::pq::parameter_binary_traits >( "SELECT length( $1 )", bytes ).as< int >() == 3 );
+   }
+
+   {
+      const auto columns = connection->execute( "SELECT i, NULLIF( i % 3, 0 ) FROM generate_series( 1, 10 ) AS i ORDER BY i" );
+      const auto i = columns.column< int >( 0 );
+      TEST_ASSERT( i.values.size() == 10 );
+      TEST_ASSERT( i.nulls.size() == 2 );
+      TEST_ASSERT( i.values[ 9 ] == 10 );
+      TEST_ASSERT( !i.is_null( 9 ) );
+      const auto j = columns.column< int >( 1 );
+      TEST_ASSERT( j.values[ 1 ] == 2 );
+      TEST_ASSERT( j.values[ 2 ] == 0 );
+      TEST_ASSERT( j.is_null( 2 ) );
+      TEST_ASSERT( j.nulls[ 0 ] == 0x24 );
+      TEST_ASSERT( j.nulls[ 1 ] == 0x01 );
+      TEST_ASSERT( !columns.column< std::optional< int > >( 1 ).values[ 5 ] );
+      TEST_ASSERT( columns.column< std::string >( 1 ).values[ 0 ] == "1" );
+   }
+   {
+      const auto columns = connection->execute< tao::pq::parameter_text_traits, tao::pq::result_format::binary >( "SELECT i::INT8, i::FLOAT8 FROM generate_series( 1, 3 ) AS i" );
+      std::vector< long long > values( 3 );
+      std::uint8_t nulls = 0xff;
+      columns.column< long long >( 0, values, tao::span< std::uint8_t >( &nulls, 1 ) );
+      TEST_ASSERT( values[ 2 ] == 3 );
+      TEST_ASSERT( nulls == 0 );
+      TEST_ASSERT( columns.column< double >( 1 ).values[ 1 ] == 2.0 );
+      TEST_THROWS( columns.column< long long >( 0, tao::span< long long >( values.data(), 2 ), tao::span< std::uint8_t >( &nulls, 1 ) ) );
+      TEST_THROWS( columns.column< int >( 1 ) );
+      TEST_THROWS( columns.column< int >( 2 ) );
+   }
+   TEST_ASSERT( connection->execute( "SELECT TRUE UNION ALL SELECT NULL" ).column< bool >( 0 ).values == std::vector< bool >{ true, false } );
+   TEST_THROWS( connection->execute( "SELECT 1" ).column< int >( 1 ) );
+
    int count = 0;
    for( const auto& row : connection->execute( "SELECT 1 UNION ALL SELECT 2" ) ) {
       TEST_ASSERT( row.as< int >() == ++count );
    }
    TEST_ASSERT( count == 2 );
+
+   static_assert( std::is_same_v< tao::pq::result::const_iterator::iterator_concept, std::random_access_iterator_tag > );
+   static_assert( std::is_same_v< std::iterator_traits< tao::pq::result::const_iterator >::iterator_category, std::input_iterator_tag > );
+#if defined( __cpp_lib_ranges )
+   static_assert( std::random_access_iterator< tao::pq::result::const_iterator > );
+   static_assert( std::ranges::random_access_range< tao::pq::result > );
+#endif
+   {
+      const auto sorted = connection->execute( "SELECT i, i * 10 FROM generate_series( 1, 100 ) AS i" );
+      TEST_ASSERT( sorted.end() - sorted.begin() == 100 );
+      TEST_ASSERT( std::distance( sorted.begin(), sorted.end() ) == 100 );
+      TEST_ASSERT( ( *( sorted.begin() + 41 ) ).as< int >() == 42 );
+      TEST_ASSERT( sorted.begin()[ 99 ].get< int >( 1 ) == 1000 );
+      auto it = sorted.end();
+      it -= 100;
+      TEST_ASSERT( it == sorted.begin() );
+      TEST_ASSERT( ( *--sorted.end() ).as< int >() == 100 );
+      TEST_ASSERT( sorted.begin() < sorted.end() );
+      TEST_ASSERT( !( sorted.end() <= sorted.begin() ) );
+
+      const auto ids = connection->execute( "SELECT i FROM generate_series( 1, 100 ) AS i" );
+      const auto keys = ids.as_range< int >();
+      TEST_ASSERT( keys.size() == 100 );
+      TEST_ASSERT( keys[ 9 ] == 10 );
+      TEST_ASSERT( std::lower_bound( keys.begin(), keys.end(), 42 ) - keys.begin() == 41 );
+      TEST_ASSERT( !std::binary_search( keys.begin(), keys.end(), 101 ) );
+      TEST_ASSERT( sorted.as_range< std::pair< int, int > >()[ 9 ] == std::pair( 10, 100 ) );
+
+      // chunks for parallel processing
+      int sum = 0;
+      for( auto first = keys.begin(); first != keys.end(); first += 25 ) {
+         for( auto value = first; value != first + 25; ++value ) {
+            sum += *value;
+         }
+      }
+      TEST_ASSERT( sum == 5050 );
+   }
+   {
+      const auto users = connection->execute( "SELECT CASE WHEN i = 2 THEN 'a@example.com' END AS email, 'user' || i AS name, i AS id, 0 AS unused FROM generate_series( 1, 3 ) AS i" );
+      const auto v = users.vector< user >();
+      TEST_ASSERT( v.size() == 3 );
+      TEST_ASSERT( v[ 1 ].id == 2 );
+      TEST_ASSERT( v[ 1 ].name == "user2" );
+      TEST_ASSERT( v[ 1 ].email == "a@example.com" );
+      TEST_ASSERT( !v[ 2 ].email );
+      TEST_ASSERT( users.parallel_vector< user >().size() == 3 );
+      TEST_ASSERT( users[ 0 ].slice( 0, 3 ).as< user >().name == "user1" );
+      TEST_ASSERT( users[ 0 ].as< user >().name == "user1" );
+      TEST_ASSERT( users.as_range< user >()[ 2 ].id == 3 );
+      TEST_ASSERT( ( *users.as_range< user >().begin() ).email == std::nullopt );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 'x' AS name, NULL AS email, 7 AS id" ).as< user >().id == 7 );
+   TEST_THROWS( connection->execute( "SELECT 'x' AS name, 7 AS id" ).vector< user >() );
+   TEST_THROWS( connection->execute( "SELECT 'x' AS name, NULL AS email, NULL::INTEGER AS id" ).vector< user >() );
+   TEST_ASSERT( connection->execute( "SELECT 1 WHERE FALSE" ).as_range< int >().empty() );
+   TEST_THROWS( connection->execute( "SELECT 1 UNION ALL SELECT NULL" ).as_range< int >()[ 1 ] );
 }
 
 auto main() -> int  // NOLINT(bugprone-exception-escape)
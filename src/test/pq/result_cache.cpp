@@ -0,0 +1,94 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <chrono>
+#include <thread>
+
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/internal/poll.hpp>
+#include <tao/pq/result_cache.hpp>
+
+void run()
+{
+   // overwrite the default with an environment variable if needed
+   const auto connection_string = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+
+   const auto pool = tao::pq::connection_pool::create( connection_string );
+   const auto connection = pool->connection();
+   connection->execute( "DROP TABLE IF EXISTS tao_result_cache_test" );
+   connection->execute( "CREATE TABLE tao_result_cache_test ( a INTEGER PRIMARY KEY, b TEXT )" );
+   connection->execute( "INSERT INTO tao_result_cache_test VALUES ( 1, 'foo' ), ( 2, 'bar' )" );
+
+   const auto cache = tao::pq::result_cache::create( pool, 1024 * 1024 );
+   const tao::pq::cache_policy policy( std::chrono::minutes( 1 ), { "tao_result_cache_test" } );
+
+   const auto r1 = cache->execute( policy, "SELECT b FROM tao_result_cache_test WHERE a = $1", 1 );
+   TEST_ASSERT( r1.is_snapshot() );
+   TEST_ASSERT( r1.as< std::string >() == "foo" );
+   TEST_ASSERT( cache->execute( policy, "SELECT b FROM tao_result_cache_test WHERE a = $1", 2 ).as< std::string >() == "bar" );
+   TEST_ASSERT( cache->size() == 2 );
+   TEST_ASSERT( cache->memory() > 0 );
+
+   // without a notification, the cached result is used
+   connection->execute( "UPDATE tao_result_cache_test SET b = 'baz' WHERE a = 1" );
+   TEST_ASSERT( cache->execute( policy, "SELECT b FROM tao_result_cache_test WHERE a = $1", 1 ).as< std::string >() == "foo" );
+   TEST_ASSERT( cache->execute( policy, "SELECT b FROM tao_result_cache_test WHERE a = $1", "1" ).as< std::string >() == "foo" );
+
+   // the notification arrives asynchronously on the cache's own connection
+   connection->notify( "tao_result_cache_test" );
+   for( int i = 0; ( i < 100 ) && ( cache->size() != 0 ); ++i ) {
+      (void)tao::pq::internal::poll( cache->socket(), tao::pq::poll_status::wait_readable, 100 );
+      cache->handle_notifications();
+   }
+   TEST_ASSERT( cache->size() == 0 );
+   TEST_ASSERT( cache->execute( policy, "SELECT b FROM tao_result_cache_test WHERE a = $1", 1 ).as< std::string >() == "baz" );
+   TEST_ASSERT( cache->size() == 1 );
+
+   cache->invalidate( "tao_result_cache_test" );
+   TEST_ASSERT( cache->size() == 0 );
+   TEST_ASSERT( cache->execute( policy, "SELECT b FROM tao_result_cache_test WHERE a = $1", 2 ).as< std::string >() == "bar" );
+   TEST_ASSERT( cache->size() == 1 );
+   cache->clear();
+   TEST_ASSERT( cache->size() == 0 );
+   TEST_ASSERT( cache->memory() == 0 );
+
+   // entries expire after their ttl
+   TEST_ASSERT( cache->execute( std::chrono::milliseconds( 1 ), "SELECT b FROM tao_result_cache_test WHERE a = 2" ).as< std::string >() == "bar" );
+   connection->execute( "UPDATE tao_result_cache_test SET b = 'qux' WHERE a = 2" );
+   std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+   TEST_ASSERT( cache->execute( std::chrono::milliseconds( 1 ), "SELECT b FROM tao_result_cache_test WHERE a = 2" ).as< std::string >() == "qux" );
+   std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+   TEST_ASSERT( cache->size() == 0 );
+
+   // results which exceed the budget are not cached, older entries are evicted
+   const auto small = tao::pq::result_cache::create( pool, 2048 );
+   TEST_ASSERT( small->execute( std::chrono::minutes( 1 ), "SELECT repeat( 'x', 4096 )" ).as< std::string >().size() == 4096 );
+   TEST_ASSERT( small->size() == 0 );
+   for( int i = 0; i < 100; ++i ) {
+      TEST_ASSERT( small->execute( std::chrono::minutes( 1 ), "SELECT $1::INTEGER", i ).as< int >() == i );
+      TEST_ASSERT( small->memory() <= 2048 );
+   }
+   TEST_ASSERT( small->size() > 0 );
+   TEST_ASSERT( small->size() < 100 );
+
+   TEST_THROWS( cache->execute( std::chrono::minutes( 1 ), "SELECT * FROM tao_result_cache_does_not_exist" ) );
+   TEST_ASSERT( cache->size() == 0 );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2020 Daniel Frey and Dr. Colin Hirsch
+// Please see LICENSE for license or visit https://github.com/taocpp/taopq/
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/result_stream.hpp>
+#include <tao/pq/result_traits_tuple.hpp>
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+
+   {
+      auto stream = connection->stream( "SELECT i, 'row ' || i AS s FROM generate_series( 1, $1 ) AS i", 1000 );
+      TEST_ASSERT( stream.columns() == 2 );
+      TEST_ASSERT( stream.name( 1 ) == "s" );
+      int count = 0;
+      for( const auto& row : stream ) {
+         ++count;
+         TEST_ASSERT( row.get< int >( 0 ) == count );
+         TEST_ASSERT( row[ "s" ].as< std::string >() == "row " + std::to_string( count ) );
+      }
+      TEST_ASSERT( count == 1000 );
+      TEST_ASSERT( stream.begin() == stream.end() );
+   }
+
+   {
+      // rows are received in chunks where supported
+      const auto tr = connection->transaction();
+      int sum = 0;
+      tr->stream( 100, "SELECT i, i * 2 FROM generate_series( 1, 1000 ) AS i" ).for_each( [ & ]( const tao::pq::row& row ) {
+         const auto [ a, b ] = row.tuple< int, int >();
+         TEST_ASSERT( b == 2 * a );
+         sum += a;
+      } );
+      TEST_ASSERT( sum == 500500 );
+      TEST_EXECUTE( tr->commit() );
+   }
+
+   {
+      auto stream = connection->stream( "SELECT 42 WHERE FALSE" );
+      TEST_ASSERT( stream.begin() == stream.end() );
+   }
+
+   // errors are reported while streaming
+   TEST_THROWS( connection->stream( "SELECT 1 / ( 5 - i ) FROM generate_series( 1, 10 ) AS i" ).for_each( []( const tao::pq::row& /*unused*/ ) {} ) );
+   TEST_THROWS( (void)connection->stream( "FOO BAR BAZ" ) );
+
+   // an abandoned stream does not block the connection
+   {
+      auto stream = connection->stream( "SELECT * FROM generate_series( 1, 1000 )" );
+      TEST_ASSERT( ( *stream.begin() ).as< int >() == 1 );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+}
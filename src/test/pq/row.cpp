@@ -75,6 +75,13 @@ void run()
    TEST_THROWS( row2.slice( 2, 1 ).index( "b" ) );
    TEST_THROWS( row2.slice( 2, 1 ).index( "B" ) );
 
+   const auto result3 = connection->execute( "SELECT 1 AS a, 2 AS \"A\", 3 AS a, 4 AS a" );
+   TEST_ASSERT( result3[ 0 ].slice( 1, 3 ).index( "a" ) == 1 );
+   TEST_ASSERT( result3[ 0 ].slice( 3, 1 ).index( "a" ) == 0 );
+   TEST_ASSERT( result3[ 0 ].slice( 1, 1 ).index( "\"A\"" ) == 0 );
+   TEST_THROWS( result3[ 0 ].slice( 1, 1 ).index( "a" ) );
+   TEST_ASSERT( result3[ 0 ].slice( 2, 2 )[ "A" ].as< int >() == 3 );
+
    TEST_THROWS( row2.slice( 0, 0 ) );
    TEST_THROWS( row2.slice( 1, 0 ) );
    TEST_THROWS( row2.slice( 2, 0 ) );
@@ -11,8 +11,10 @@ auto main() -> int {}
 #include <stdexcept>
 #include <typeinfo>
 
+#include <tao/pq/internal/from_chars.hpp>
 #include <tao/pq/internal/printf.hpp>
 #include <tao/pq/internal/strtox.hpp>
+#include <tao/pq/result_traits.hpp>
 
 template< typename T >
 void reject( const char* input, const int base = 10 )
@@ -92,6 +94,17 @@ void reject_floating_point( const char* input )
    }
 }
 
+template< typename T, typename E >
+void reject_result( const char* input )
+{
+   try {
+      (void)tao::pq::result_traits< T >::from( input );
+      throw std::runtime_error( tao::pq::internal::printf( "result_traits<T>::from(): %s", input ) );
+   }
+   catch( const E& /*unused*/ ) {
+   }
+}
+
 void run()  // NOLINT(readability-function-size)
 {
    TEST_ASSERT( tao::pq::internal::strtol( "0" ) == 0 );
@@ -299,6 +312,33 @@ void run()  // NOLINT(readability-function-size)
    reject_floating_point< std::overflow_error >( "-1e10000" );
    reject_floating_point< std::underflow_error >( "1e-10000" );
    reject_floating_point< std::underflow_error >( "-1e-10000" );
+
+   TEST_ASSERT( tao::pq::internal::from_chars< int >( "-2147483648" ) == -2147483647 - 1 );
+   TEST_ASSERT( tao::pq::internal::from_chars< unsigned long long >( "18446744073709551615" ) == 18446744073709551615U );
+   TEST_ASSERT( !tao::pq::internal::from_chars< int >( "" ) );
+   TEST_ASSERT( !tao::pq::internal::from_chars< int >( "+1" ) );
+   TEST_ASSERT( !tao::pq::internal::from_chars< int >( " 1" ) );
+   TEST_ASSERT( !tao::pq::internal::from_chars< int >( "1 " ) );
+   TEST_ASSERT( !tao::pq::internal::from_chars< short >( "32768" ) );
+   TEST_ASSERT( !tao::pq::internal::from_chars< unsigned >( "-1" ) );
+#if defined( TAO_PQ_USE_FLOATING_POINT_FROM_CHARS )
+   TEST_ASSERT( tao::pq::internal::from_chars< double >( "0.1" ) == 0.1 );
+   TEST_ASSERT( std::isinf( *tao::pq::internal::from_chars< double >( "-Infinity" ) ) );
+   TEST_ASSERT( std::isnan( *tao::pq::internal::from_chars< double >( "NaN" ) ) );
+   TEST_ASSERT( !tao::pq::internal::from_chars< double >( "1e10000" ) );
+#endif
+
+   // the from_chars() fast path must not change which inputs are rejected and how
+   TEST_ASSERT( tao::pq::result_traits< short >::from( "-32768" ) == -32768 );
+   TEST_ASSERT( tao::pq::result_traits< short >::from( "+1" ) == 1 );
+   reject_result< short, std::overflow_error >( "32768" );
+   reject_result< short, std::underflow_error >( "-32769" );
+   reject_result< long long, std::overflow_error >( "9223372036854775808" );
+   reject_result< long long, std::underflow_error >( "-9223372036854775809" );
+   TEST_THROWS( tao::pq::result_traits< int >::from( " 1" ) );
+   TEST_ASSERT( tao::pq::result_traits< double >::from( "0.1" ) == 0.1 );
+   reject_result< double, std::overflow_error >( "1e10000" );
+   reject_result< double, std::underflow_error >( "1e-10000" );
 }
 
 auto main() -> int  // NOLINT(bugprone-exception-escape)
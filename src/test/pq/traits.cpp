@@ -4,6 +4,9 @@
 #include "../getenv.hpp"
 #include "../macros.hpp"
 
+#include <cmath>
+#include <cstring>
+
 #include <tao/pq/connection.hpp>
 #include <tao/pq/result_traits_tuple.hpp>
 
@@ -85,6 +88,20 @@ void run()
          TEST_ASSERT( d == c + 1 );
       }
    }
+
+   {
+      const tao::pq::parameter_text_traits< long long > v( -9223372036854775807LL - 1 );
+      TEST_ASSERT( v.value< 0 >() == std::string( "-9223372036854775808" ) );
+      TEST_ASSERT( v.length< 0 >() == 20 );
+   }
+   {
+      const tao::pq::parameter_text_traits< double > v( 0.1 );
+      TEST_ASSERT( v.length< 0 >() == static_cast< int >( std::strlen( v.value< 0 >() ) ) );
+   }
+   TEST_ASSERT( tao::pq::parameter_text_traits< double >( -INFINITY ).value< 0 >() == std::string( "-INF" ) );
+   TEST_ASSERT( connection->execute( "SELECT $1::DOUBLE PRECISION", 0.1 ).as< double >() == 0.1 );
+   TEST_ASSERT( connection->execute( "SELECT $1::REAL", 0.1F ).as< float >() == 0.1F );
+   TEST_ASSERT( connection->execute( "SELECT $1::NUMERIC", 1e20 ).as< double >() == 1e20 );
 }
 
 auto main() -> int  //NOLINT(bugprone-exception-escape)
@@ -100,6 +100,27 @@ void run()
    TEST_EXECUTE( connection->transaction()->subtransaction()->subtransaction()->commit() );
    TEST_EXECUTE( connection->transaction()->subtransaction()->subtransaction()->rollback() );
 
+   TEST_EXECUTE( (void)connection->direct()->async_commit().get() );
+   TEST_EXECUTE( (void)connection->transaction()->async_rollback().get() );
+   TEST_EXECUTE( (void)connection->transaction()->subtransaction()->async_commit().get() );
+
+   {
+      const auto tr = connection->transaction();
+      TEST_EXECUTE( tr->execute( "INSERT INTO tao_transaction_test VALUES ( 4 )" ) );
+      auto ar = tr->async_commit();
+      TEST_ASSERT( !ar.get().has_rows_affected() );
+      TEST_THROWS( tr->execute( "SELECT 42" ) );
+   }
+   TEST_ASSERT( connection->execute( "SELECT * FROM tao_transaction_test" ).size() == 3 );
+
+   {
+      // an abandoned async commit still ends the transaction
+      const auto tr = connection->transaction();
+      (void)tr->async_commit();
+      TEST_THROWS( tr->execute( "SELECT 42" ) );
+      TEST_EXECUTE( (void)connection->transaction() );
+   }
+
    TEST_EXECUTE( (void)connection->transaction( tao::pq::transaction::isolation_level::serializable ) );
    TEST_EXECUTE( (void)connection->transaction( tao::pq::transaction::isolation_level::repeatable_read ) );
    TEST_EXECUTE( (void)connection->transaction( tao::pq::transaction::isolation_level::read_committed ) );